@@ -0,0 +1,92 @@
+#include "parta_coro.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+/**
+ * Benchmark for the coroutine process model.
+ *
+ * Usage:
+ *   ./bench_parta_coro [plen] [requests] [quantum]
+ *
+ * Runs plen (default 1M) request handlers, each serving `requests`
+ * (default 4) requests of CPU in [1, 8] followed by I/O in [1, 4] or,
+ * every other request, a sleep in [1, 64], and prints the cost per
+ * coroutine resume and per simulated request.
+ */
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+struct handler_state {
+    unsigned seed;
+    int requests;
+    int i;
+};
+
+/** Small per-handler generator, so handlers do not share rand() state */
+static int next_rand(struct handler_state* s, int range) {
+    s->seed = s->seed * 1103515245u + 12345u;
+    return 1 + (int)((s->seed >> 16) % (unsigned)range);
+}
+
+static void handler(struct coro* co) {
+    struct handler_state* s = co->state;
+    CO_BEGIN(co);
+    for (s->i = 0; s->i < s->requests; s->i++) {
+        CO_YIELD(co, CORO_CPU, next_rand(s, 8));
+        if (s->i % 2 == 0) {
+            CO_YIELD(co, CORO_IO, next_rand(s, 4));
+        } else {
+            CO_YIELD(co, CORO_SLEEP, next_rand(s, 64));
+        }
+    }
+    CO_END(co);
+}
+
+int main(int argc, char* argv[]) {
+    int plen = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int requests = (argc > 2) ? atoi(argv[2]) : 4;
+    int quantum = (argc > 3) ? atoi(argv[3]) : 4;
+    if (plen <= 0 || requests < 0 || quantum < 0) {
+        fprintf(stderr, "ERROR: Invalid arguments\n");
+        return 1;
+    }
+
+    struct coro* cos = malloc(sizeof(struct coro) * plen);
+    struct handler_state* st = malloc(sizeof(struct handler_state) * plen);
+    struct pcb* procs = malloc(sizeof(struct pcb) * plen);
+    if (cos == NULL || st == NULL || procs == NULL) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        return 1;
+    }
+    for (int i = 0; i < plen; i++) {
+        st[i] = (struct handler_state){ (unsigned)i * 2654435761u + 1u, requests, 0 };
+        coro_init(&cos[i], handler, &st[i]);
+    }
+
+    struct coro_stats stats = { 0 };
+    double start = now_ms();
+    int total_time = coro_run(cos, plen, quantum, procs, &stats);
+    double ms = now_ms() - start;
+
+    double sum_wait = 0.0;
+    for (int i = 0; i < plen; i++) {
+        sum_wait += procs[i].wait;
+    }
+    printf("coro plen=%d requests=%d quantum=%d total=%d cpu_util=%.2f io_util=%.2f "
+           "avg_wait=%.1f\n",
+           plen, requests, quantum, total_time,
+           (total_time > 0) ? (double)stats.busy / total_time : 0.0,
+           (total_time > 0) ? (double)stats.io_busy / total_time : 0.0, sum_wait / plen);
+    printf("coro time=%.1fms resumes=%lld ns/resume=%.1f ns/request=%.1f\n", ms, stats.resumes,
+           (stats.resumes > 0) ? ms * 1e6 / stats.resumes : 0.0,
+           (requests > 0) ? ms * 1e6 / ((double)plen * requests) : 0.0);
+
+    free(cos);
+    free(st);
+    free(procs);
+    return (stats.completed == plen) ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+#include "parta_eevdf.h"
+#include "parta_inc.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+/**
+ * Benchmark for the EEVDF scheduler.
+ *
+ * Usage:
+ *   ./bench_parta_eevdf [plen] [slice]
+ *
+ * Over plen (default 1M) processes with bursts in [1, 16] and weights in
+ * [1, 1024], times eevdf_run, and rr_analytic_run on the same bursts as
+ * a baseline, printing the cost per scheduling decision.
+ */
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+    int plen = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int slice = (argc > 2) ? atoi(argv[2]) : 4;
+    if (plen <= 0 || slice <= 0) {
+        fprintf(stderr, "ERROR: Invalid arguments\n");
+        return 1;
+    }
+
+    int* bursts = malloc(sizeof(int) * plen);
+    int* weights = malloc(sizeof(int) * plen);
+    int* latency = malloc(sizeof(int) * plen);
+    if (bursts == NULL || weights == NULL || latency == NULL) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        return 1;
+    }
+    srand(1);
+    long long picks = 0;
+    for (int i = 0; i < plen; i++) {
+        bursts[i] = 1 + rand() % 16;
+        weights[i] = 1 + rand() % 1024;
+        picks += (bursts[i] + slice - 1) / slice;
+    }
+
+    struct pcb* procs = init_procs(bursts, plen);
+    if (procs == NULL) {
+        fprintf(stderr, "ERROR: Failed to initialize processes\n");
+        return 1;
+    }
+    double start = now_ms();
+    int total_time = rr_analytic_run(procs, plen, slice);
+    printf("%-8s plen=%d total=%d time=%.1fms\n", "analytic", plen, total_time, now_ms() - start);
+    free(procs);
+
+    procs = init_procs(bursts, plen);
+    if (procs == NULL) {
+        fprintf(stderr, "ERROR: Failed to initialize processes\n");
+        return 1;
+    }
+    start = now_ms();
+    total_time = eevdf_run(procs, plen, weights, slice, latency);
+    double ms = now_ms() - start;
+    double sum_wait = 0.0;
+    double sum_latency = 0.0;
+    for (int i = 0; i < plen; i++) {
+        sum_wait += procs[i].wait;
+        sum_latency += latency[i];
+    }
+    printf("%-8s plen=%d total=%d avg_wait=%.1f avg_latency=%.1f time=%.1fms (%.0fns/pick)\n",
+           "eevdf", plen, total_time, sum_wait / plen, sum_latency / plen, ms,
+           ms * 1e6 / picks);
+
+    free(procs);
+    free(bursts);
+    free(weights);
+    free(latency);
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include "parta_hrrn.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+/**
+ * Benchmark for HRRN on the kinetic tournament.
+ *
+ * Usage:
+ *   ./bench_parta_hrrn [plen] [scan_plen]
+ *
+ * Over plen (default 1M) processes with bursts in [1, 20] (every 10th in
+ * [1, 400]) arriving at random at about the rate the CPU serves them,
+ * times hrrn_run and prints the certificate failures per decision. The
+ * first scan_plen (default 20000) processes are also run by rescanning
+ * every arrived process at each decision, as a baseline.
+ */
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+/** HRRN by a linear scan over the processes at each decision. */
+static int hrrn_scan(struct pcb* procs, int plen, const int* arrival) {
+    long long t = 0;
+    for (;;) {
+        int best = -1;
+        long long first = -1;
+        for (int i = 0; i < plen; i++) {
+            if (procs[i].burst_left <= 0) {
+                continue;
+            }
+            if (arrival[i] > t) {
+                first = (first < 0 || arrival[i] < first) ? arrival[i] : first;
+                continue;
+            }
+            if (best < 0 ||
+                (long long)(t - arrival[i] + procs[i].burst_left) * procs[best].burst_left >
+                    (long long)(t - arrival[best] + procs[best].burst_left) * procs[i].burst_left) {
+                best = i;
+            }
+        }
+        if (best < 0 && first < 0) {
+            return (int)t;
+        }
+        if (best < 0) {
+            t = first;
+            continue;
+        }
+        procs[best].wait += (int)(t - arrival[best]);
+        t += procs[best].burst_left;
+        procs[best].burst_left = 0;
+    }
+}
+
+static bool run(const char* name, const int* bursts, const int* arrival, int plen, bool scan) {
+    struct pcb* procs = init_procs((int*)bursts, plen);
+    if (procs == NULL) {
+        fprintf(stderr, "ERROR: Failed to initialize processes\n");
+        return false;
+    }
+    long long events = 0;
+    double start = now_ms();
+    int total_time = scan ? hrrn_scan(procs, plen, arrival)
+                          : hrrn_run(procs, plen, arrival, &events);
+    double ms = now_ms() - start;
+    double sum_wait = 0.0;
+    for (int i = 0; i < plen; i++) {
+        sum_wait += procs[i].wait;
+    }
+    printf("%-8s plen=%d total=%d avg_wait=%.1f time=%.1fms", name, plen, total_time,
+           sum_wait / plen, ms);
+    if (!scan) {
+        printf(" events/decision=%.2f", (double)events / plen);
+    }
+    printf("\n");
+    free(procs);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    int plen = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int scan_plen = (argc > 2) ? atoi(argv[2]) : 20000;
+    if (plen <= 0 || scan_plen < 0) {
+        fprintf(stderr, "ERROR: Invalid arguments\n");
+        return 1;
+    }
+    scan_plen = (scan_plen < plen) ? scan_plen : plen;
+
+    int* bursts = malloc(sizeof(int) * plen);
+    int* arrival = malloc(sizeof(int) * plen);
+    if (bursts == NULL || arrival == NULL) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        return 1;
+    }
+    // Mean burst is ~30, so arrivals over 30 * plen keep the CPU busy.
+    srand(1);
+    for (int i = 0; i < plen; i++) {
+        bursts[i] = 1 + rand() % ((i % 10 == 0) ? 400 : 20);
+        arrival[i] = (int)((long long)rand() * 30 * plen / RAND_MAX);
+    }
+
+    bool ok = run("kinetic", bursts, arrival, plen, false);
+    if (ok && scan_plen > 0) {
+        // The same rule on a prefix (arrivals scaled to keep the load)
+        for (int i = 0; i < scan_plen; i++) {
+            arrival[i] = (int)((long long)arrival[i] * scan_plen / plen);
+        }
+        ok = run("kinetic", bursts, arrival, scan_plen, false) &&
+             run("scan", bursts, arrival, scan_plen, true);
+    }
+
+    free(bursts);
+    free(arrival);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,87 @@
+#include "parta_inc.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+/**
+ * Benchmark for the incremental Round-Robin engine.
+ *
+ * Usage:
+ *   ./bench_parta_inc [plen] [quantum] [updates]
+ *
+ * Over plen (default 100k) processes, most with bursts in [1, 8] and
+ * every 100th with a burst in [1, 1000], times rr_run, rr_analytic_run
+ * and building an engine, then `updates` (default 10000) revisions of a
+ * long burst by up to a quantum, printing the mean time and the mean
+ * number of processes each one touched.
+ */
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+    int plen = (argc > 1) ? atoi(argv[1]) : 100000;
+    int quantum = (argc > 2) ? atoi(argv[2]) : 4;
+    int updates = (argc > 3) ? atoi(argv[3]) : 10000;
+    if (plen <= 0 || quantum <= 0 || updates <= 0) {
+        fprintf(stderr, "ERROR: Invalid arguments\n");
+        return 1;
+    }
+
+    int* bursts = malloc(sizeof(int) * plen);
+    if (bursts == NULL) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        return 1;
+    }
+    srand(1);
+    for (int i = 0; i < plen; i++) {
+        bursts[i] = 1 + rand() % ((i % 100 == 0) ? 1000 : 8);
+    }
+
+    struct pcb* procs = init_procs(bursts, plen);
+    if (procs == NULL) {
+        fprintf(stderr, "ERROR: Failed to initialize processes\n");
+        return 1;
+    }
+    double start = now_ms();
+    int total_time = rr_run(procs, plen, quantum);
+    printf("%-10s plen=%d total=%d time=%.1fms\n", "rr_run", plen, total_time, now_ms() - start);
+    free(procs);
+
+    procs = init_procs(bursts, plen);
+    if (procs == NULL) {
+        fprintf(stderr, "ERROR: Failed to initialize processes\n");
+        return 1;
+    }
+    start = now_ms();
+    total_time = rr_analytic_run(procs, plen, quantum);
+    printf("%-10s plen=%d total=%d time=%.1fms\n", "analytic", plen, total_time, now_ms() - start);
+    free(procs);
+
+    start = now_ms();
+    struct rr_inc* e = rr_inc_create(bursts, plen, quantum);
+    if (e == NULL) {
+        fprintf(stderr, "ERROR: Failed to create engine\n");
+        return 1;
+    }
+    printf("%-10s plen=%d time=%.1fms\n", "create", plen, now_ms() - start);
+
+    long long touched = 0;
+    start = now_ms();
+    for (int u = 0; u < updates; u++) {
+        // A long job's estimate is revised
+        int pid = (rand() % ((plen + 99) / 100)) * 100;
+        int burst = bursts[pid] + rand() % (2 * quantum + 1) - quantum;
+        bursts[pid] = (burst > 0) ? burst : 1;
+        touched += rr_inc_set(e, pid, bursts[pid]);
+    }
+    double ms = now_ms() - start;
+    printf("%-10s updates=%d avg_changed=%.1f avg_wait=%.2f time=%.3fus/update\n", "update",
+           updates, (double)touched / updates, rr_inc_avg_wait(e), ms * 1e3 / updates);
+
+    rr_inc_free(e);
+    free(bursts);
+    return 0;
+}
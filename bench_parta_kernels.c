@@ -0,0 +1,166 @@
+#include "parta_kernels.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * Benchmark for the dispatched kernels.
+ *
+ * Usage:
+ *   ./bench_parta_kernels [plen]
+ *
+ * Times every variant this CPU supports (wait update, FCFS prefix sum,
+ * RR round skip) on plen (default 1M) PCBs and prints ns per PCB.
+ *
+ * Then compares the wait update on AoS and SoA layouts against the
+ * original branchy run_proc loop at plen = 1k, 100k and 10M, and rr_run
+ * on 8 to 64 processes (the one-word engines) against the generic loop.
+ */
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/** The run_proc loop as first written, kept scalar for reference. */
+__attribute__((noinline, optimize("no-tree-vectorize")))
+static void wait_update_branchy(struct pcb* procs, int plen, int current, int run_time) {
+    for (int i = 0; i < plen; i++) {
+        if (i == current) continue;
+        if (procs[i].burst_left > 0) {
+            procs[i].wait += run_time;
+        }
+    }
+}
+
+static void fill(struct pcb* procs, int plen) {
+    srand(1);
+    for (int i = 0; i < plen; i++) {
+        procs[i].pid = i;
+        procs[i].burst_left = (i % 8 == 0) ? 0 : 1000 + rand() % 1000;
+        procs[i].wait = 0;
+        procs[i].priority = 0;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int plen = (argc > 1) ? atoi(argv[1]) : 1000000;
+    if (plen <= 0) {
+        fprintf(stderr, "ERROR: Invalid arguments\n");
+        return 1;
+    }
+
+    struct pcb* procs = malloc(sizeof(struct pcb) * plen);
+    if (procs == NULL) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        return 1;
+    }
+
+    int reps = 50;
+    printf("selected: %s\n", kernels()->name);
+    for (int isa = 0; isa < KERNEL_ISA_COUNT; isa++) {
+        const struct kernel_ops* ops = kernel_variant(isa);
+        if (ops == NULL) {
+            continue;
+        }
+
+        fill(procs, plen);
+        double start = now_ns();
+        for (int r = 0; r < reps; r++) {
+            ops->wait_update(procs, plen, r % plen, 1);
+        }
+        double wait_ns = (now_ns() - start) / ((double)reps * plen);
+
+        start = now_ns();
+        for (int r = 0; r < reps; r++) {
+            ops->rr_skip(procs, plen, 4);
+        }
+        double skip_ns = (now_ns() - start) / ((double)reps * plen);
+
+        double prefix_ns = 0.0;
+        for (int r = 0; r < reps; r++) {
+            fill(procs, plen);
+            start = now_ns();
+            ops->fcfs_prefix(procs, plen);
+            prefix_ns += now_ns() - start;
+        }
+        prefix_ns /= (double)reps * plen;
+
+        printf("%-8s plen=%d wait_update=%.3fns rr_skip=%.3fns fcfs_prefix=%.3fns\n",
+               ops->name, plen, wait_ns, skip_ns, prefix_ns);
+    }
+
+    free(procs);
+
+    int sizes[] = { 1000, 100000, 10000000 };
+    for (int s = 0; s < 3; s++) {
+        int n = sizes[s];
+        int iters = (int)(200000000LL / n);
+        procs = malloc(sizeof(struct pcb) * n);
+        if (procs == NULL) {
+            fprintf(stderr, "ERROR: Memory allocation failed\n");
+            return 1;
+        }
+        fill(procs, n);
+
+        double start = now_ns();
+        for (int r = 0; r < iters; r++) {
+            wait_update_branchy(procs, n, r % n, 1);
+        }
+        double base = (now_ns() - start) / ((double)iters * n);
+        printf("plen=%-9d branchy  %.3fns\n", n, base);
+
+        struct pcb_soa soa;
+        if (!pcb_soa_init(&soa, procs, n)) {
+            fprintf(stderr, "ERROR: Memory allocation failed\n");
+            return 1;
+        }
+        for (int isa = 0; isa < KERNEL_ISA_COUNT; isa++) {
+            const struct kernel_ops* ops = kernel_variant(isa);
+            if (ops == NULL) {
+                continue;
+            }
+
+            start = now_ns();
+            for (int r = 0; r < iters; r++) {
+                ops->wait_update(procs, n, r % n, 1);
+            }
+            double aos = (now_ns() - start) / ((double)iters * n);
+
+            start = now_ns();
+            for (int r = 0; r < iters; r++) {
+                ops->wait_update_soa(&soa, r % n, 1);
+            }
+            double soa_ns = (now_ns() - start) / ((double)iters * n);
+
+            printf("plen=%-9d %-8s aos=%.3fns (%.1fx) soa=%.3fns (%.1fx)\n",
+                   n, ops->name, aos, base / aos, soa_ns, base / soa_ns);
+        }
+        pcb_soa_free(&soa);
+        free(procs);
+    }
+
+    // Small-N RR: the same workload, then padded to RR_SMALL_MAX + 1 with
+    // empty processes so rr_run takes the generic path.
+    struct pcb small[RR_SMALL_MAX + 1];
+    int small_sizes[] = { 8, 16, 32, 64 };
+    for (int s = 0; s < 4; s++) {
+        int n = small_sizes[s];
+        int iters = 200000;
+        double ns[2];
+        for (int generic = 0; generic < 2; generic++) {
+            double start = now_ns();
+            for (int r = 0; r < iters; r++) {
+                for (int i = 0; i <= RR_SMALL_MAX; i++) {
+                    small[i] = (struct pcb){ i, (i < n) ? 1 + (i * 7 + r) % 23 : 0, 0, 0 };
+                }
+                rr_run(small, generic ? RR_SMALL_MAX + 1 : n, 4);
+            }
+            ns[generic] = (now_ns() - start) / iters;
+        }
+        printf("rr_run plen=%-3d small=%.0fns generic=%.0fns (%.1fx)\n", n, ns[0], ns[1],
+               ns[1] / ns[0]);
+    }
+    return 0;
+}
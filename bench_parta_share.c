@@ -0,0 +1,83 @@
+#include "parta_share.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+/**
+ * Benchmark for the proportional-share schedulers.
+ *
+ * Usage:
+ *   ./bench_parta_share [plen] [quantum]
+ *
+ * Runs lottery_run and stride_run over plen (default 1M) processes with
+ * random bursts in [1, 64] and random tickets in [1, 100], then prints
+ * the run time, average wait and worst fairness error of each.
+ */
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static void report(const char* name, struct pcb* procs, int plen, const double* err,
+                   int total_time, double ms) {
+    double sum_wait = 0.0;
+    double worst = 0.0;
+    for (int i = 0; i < plen; i++) {
+        sum_wait += procs[i].wait;
+        double e = (err[i] < 0) ? -err[i] : err[i];
+        if (e > worst) {
+            worst = e;
+        }
+    }
+    printf("%-8s plen=%d total=%d avg_wait=%.2f max_fair_err=%.4f time=%.1fms\n",
+           name, plen, total_time, sum_wait / plen, worst, ms);
+}
+
+int main(int argc, char* argv[]) {
+    int plen = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int quantum = (argc > 2) ? atoi(argv[2]) : 4;
+    if (plen <= 0 || quantum <= 0) {
+        fprintf(stderr, "ERROR: Invalid arguments\n");
+        return 1;
+    }
+
+    int* bursts = malloc(sizeof(int) * plen);
+    int* tickets = malloc(sizeof(int) * plen);
+    double* err = malloc(sizeof(double) * plen);
+    if (bursts == NULL || tickets == NULL || err == NULL) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        return 1;
+    }
+
+    srand(1);
+    for (int i = 0; i < plen; i++) {
+        bursts[i] = 1 + rand() % 64;
+        tickets[i] = 1 + rand() % 100;
+    }
+
+    struct pcb* procs = init_procs(bursts, plen);
+    if (procs == NULL) {
+        fprintf(stderr, "ERROR: Failed to initialize processes\n");
+        return 1;
+    }
+    double start = now_ms();
+    int total_time = lottery_run(procs, plen, tickets, quantum, 1, err);
+    report("lottery", procs, plen, err, total_time, now_ms() - start);
+    free(procs);
+
+    procs = init_procs(bursts, plen);
+    if (procs == NULL) {
+        fprintf(stderr, "ERROR: Failed to initialize processes\n");
+        return 1;
+    }
+    start = now_ms();
+    total_time = stride_run(procs, plen, tickets, quantum, err);
+    report("stride", procs, plen, err, total_time, now_ms() - start);
+    free(procs);
+
+    free(bursts);
+    free(tickets);
+    free(err);
+    return 0;
+}
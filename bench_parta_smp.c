@@ -0,0 +1,90 @@
+#include "parta_smp.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * Benchmark for the multi-CPU model.
+ *
+ * Usage:
+ *   ./bench_parta_smp [cpus] [plen] [quantum] [latency]
+ *
+ * Over plen (default 200k) processes with bursts in [1, 200] on cpus
+ * (default 256) simulated CPUs, runs smp_run as the reference, then
+ * times smp_run_parallel on 1, 2, 4, ... host threads up to the number of
+ * CPUs of the host, printing the scaling over one thread and checking the
+ * waits match. smp_run steps the CPUs from one global heap, a different
+ * algorithm from the per-CPU epoch loop, so its time is shown but not
+ * compared against.
+ */
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+    struct smp_config config = { 256, 4, 32 };
+    int plen = 200000;
+    config.cpus = (argc > 1) ? atoi(argv[1]) : config.cpus;
+    plen = (argc > 2) ? atoi(argv[2]) : plen;
+    config.quantum = (argc > 3) ? atoi(argv[3]) : config.quantum;
+    config.latency = (argc > 4) ? atoi(argv[4]) : config.latency;
+    if (config.cpus <= 0 || plen <= 0 || config.quantum <= 0 || config.latency <= 0) {
+        fprintf(stderr, "ERROR: Invalid arguments\n");
+        return 1;
+    }
+
+    int* bursts = malloc(sizeof(int) * plen);
+    if (bursts == NULL) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        return 1;
+    }
+    srand(1);
+    for (int i = 0; i < plen; i++) {
+        // Uneven: every 8th process is long, so CPUs run dry at different times
+        bursts[i] = 1 + rand() % ((i % 8 == 0) ? 1600 : 100);
+    }
+
+    struct pcb* expected = init_procs(bursts, plen);
+    if (expected == NULL) {
+        fprintf(stderr, "ERROR: Failed to initialize processes\n");
+        return 1;
+    }
+    struct smp_stats stats;
+    double start = now_ms();
+    if (!smp_run(expected, plen, &config, &stats)) {
+        fprintf(stderr, "ERROR: Simulation failed\n");
+        return 1;
+    }
+    double seq_ms = now_ms() - start;
+    printf("%-12s cpus=%d plen=%d total=%lld steals=%lld time=%.1fms\n", "reference",
+           config.cpus, plen, stats.total_time, stats.steals, seq_ms);
+
+    long host = sysconf(_SC_NPROCESSORS_ONLN);
+    double one_ms = 0.0;
+    for (int threads = 1; threads <= ((host > 1) ? host : 1); threads *= 2) {
+        struct pcb* procs = init_procs(bursts, plen);
+        if (procs == NULL) {
+            fprintf(stderr, "ERROR: Failed to initialize processes\n");
+            return 1;
+        }
+        start = now_ms();
+        bool ok = smp_run_parallel(procs, plen, &config, threads, &stats);
+        double ms = now_ms() - start;
+        bool same = ok && memcmp(procs, expected, sizeof(struct pcb) * plen) == 0;
+        one_ms = (threads == 1) ? ms : one_ms;
+        printf("%-12s threads=%d epochs=%lld time=%.1fms scaling=%.2fx %s\n", "parallel",
+               threads, stats.epochs, ms, one_ms / ms, same ? "identical" : "MISMATCH");
+        free(procs);
+        if (!same) {
+            return 1;
+        }
+    }
+
+    free(expected);
+    free(bursts);
+    return 0;
+}
@@ -1,6 +1,8 @@
 #include "parta.h"
+#include "parta_kernels.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdint.h>
 
 /** /
  * Initialize an array of PCBs on the heap from an array of CPU bursts.
@@ -8,6 +10,7 @@
  *   - pid = its index in the array
  *   - burst_left = bursts[i]
  *   - wait = 0
+ *   - priority = 0
  *
  * Returns a pointer to the allocated PCB array (caller must free).
  */
@@ -25,6 +28,7 @@ struct pcb* init_procs(int* bursts, int blen) {
         procs[i].pid = i;
         procs[i].burst_left = bursts[i];
         procs[i].wait = 0;
+        procs[i].priority = 0;
     }
 
     return procs;
@@ -72,10 +76,20 @@ void run_proc(struct pcb* procs, int plen, int current, int amount) {
     procs[current].burst_left -= run_time;
 
     // Everyone else with remaining burst waits.
+    kernels()->wait_update(procs, plen, current, run_time);
+}
+
+/**
+ * Charge `amount` of scheduler overhead (no process is running).
+ * Every process with burst_left > 0 has its wait increased by amount.
+ */
+void run_overhead(struct pcb* procs, int plen, int amount) {
+    if (procs == NULL || plen <= 0) return;
+    if (amount <= 0) return;
+
     for (int i = 0; i < plen; i++) {
-        if (i == current) continue;
         if (procs[i].burst_left > 0) {
-            procs[i].wait += run_time;
+            procs[i].wait += amount;
         }
     }
 }
@@ -83,7 +97,10 @@ void run_proc(struct pcb* procs, int plen, int current, int amount) {
 /**
  * Run all processes using First-Come-First-Serve (FCFS).
  * Start from pid 0 and run each process until completion.
- * Uses run_proc to update burst_left and wait fields.
+ *
+ * Running the processes one by one with run_proc would make every
+ * process wait for the sum of the earlier bursts, so this is computed
+ * directly as a prefix sum in O(plen).
  *
  * Returns the total time elapsed when all processes are complete.
  */
@@ -92,18 +109,60 @@ int fcfs_run(struct pcb* procs, int plen) {
         return 0;
     }
 
-    int total_time = 0;
+    return kernels()->fcfs_prefix(procs, plen);
+}
+
+/** Sort key for sjf_run, ordered by (burst, pid) */
+struct sjf_key {
+    int burst;
+    int idx;
+};
+
+static int sjf_cmp(const void* a, const void* b) {
+    const struct sjf_key* x = a;
+    const struct sjf_key* y = b;
+    if (x->burst != y->burst) {
+        return (x->burst < y->burst) ? -1 : 1;
+    }
+    return (x->idx > y->idx) - (x->idx < y->idx);
+}
+
+/**
+ * Run all processes using non-preemptive Shortest-Job-First (SJF).
+ * Every process arrives at time 0, so this is FCFS over the processes
+ * sorted by burst (ties go to the lower pid).
+ *
+ * Returns the total time elapsed when all processes are complete.
+ */
+int sjf_run(struct pcb* procs, int plen) {
+    if (procs == NULL || plen <= 0) {
+        return 0;
+    }
 
+    struct sjf_key* keys = malloc(sizeof(struct sjf_key) * plen);
+    if (keys == NULL) {
+        return 0;
+    }
+
+    int n = 0;
     for (int i = 0; i < plen; i++) {
-        int remaining = procs[i].burst_left;
-        if (remaining <= 0) {
-            continue;
+        if (procs[i].burst_left > 0) {
+            keys[n].burst = procs[i].burst_left;
+            keys[n].idx = i;
+            n++;
         }
+    }
+    qsort(keys, n, sizeof(struct sjf_key), sjf_cmp);
 
-        run_proc(procs, plen, i, remaining);
-        total_time += remaining;
+    int total_time = 0;
+    for (int k = 0; k < n; k++) {
+        struct pcb* p = &procs[keys[k].idx];
+        p->wait += total_time;
+        p->burst_left = 0;
+        total_time += keys[k].burst;
     }
 
+    free(keys);
     return total_time;
 }
 
@@ -122,6 +181,9 @@ int rr_next(int current, struct pcb* procs, int plen) {
     if (procs == NULL || plen <= 0) {
         return -1;
     }
+    if (plen <= RR_SMALL_MAX && current >= -1 && current < plen) {
+        return rr_small_next(current, procs, plen);
+    }
 
     // First check if any process still has work.
     int has_work = 0;
@@ -156,6 +218,10 @@ int rr_next(int current, struct pcb* procs, int plen) {
  *   - Run the current process for min(quantum, burst_left[current]).
  *   - Update waits using run_proc.
  *   - Use rr_next to choose the next process.
+ * At the start of every round, full rounds in which no process can
+ * finish are applied in one step (see rr_skip in parta_kernels.c).
+ * Up to RR_SMALL_MAX processes run on a one-word engine instead (see
+ * rr_small_run).
  *
  * Returns the total time elapsed when all processes are complete.
  */
@@ -163,6 +229,9 @@ int rr_run(struct pcb* procs, int plen, int quantum) {
     if (procs == NULL || plen <= 0 || quantum <= 0) {
         return 0;
     }
+    if (plen <= RR_SMALL_MAX) {
+        return rr_small_run(procs, plen, quantum);
+    }
 
     int total_time = 0;
 
@@ -179,6 +248,9 @@ int rr_run(struct pcb* procs, int plen, int quantum) {
         return 0;
     }
 
+    // Skip every full round in which no process can finish.
+    total_time += kernels()->rr_skip(procs, plen, quantum);
+
     while (1) {
         int remaining = procs[current].burst_left;
         if (remaining > 0) {
@@ -191,8 +263,281 @@ int rr_run(struct pcb* procs, int plen, int quantum) {
         if (next == -1) {
             break;  // all done
         }
+        if (next <= current) {
+            // Wrapped around: a new round starts at next.
+            total_time += kernels()->rr_skip(procs, plen, quantum);
+        }
         current = next;
     }
 
     return total_time;
 }
+
+/**
+ * Cost of switching to a process that last ran `away` time units ago:
+ * the fixed dispatch overhead plus a cache-refill penalty of
+ * min(cache_max, away / cache_decay). A process that never ran before
+ * pays the full cache_max.
+ *
+ * This is a pure function of the dispatch, so any RR engine can charge
+ * it the same way rr_run_cost does.
+ */
+int switch_cost_ticks(const struct switch_cost* cost, int away, bool first_run) {
+    if (cost == NULL) {
+        return 0;
+    }
+
+    int ticks = (cost->dispatch > 0) ? cost->dispatch : 0;
+    if (cost->cache_max > 0 && cost->cache_decay > 0) {
+        int refill = first_run ? cost->cache_max : away / cost->cache_decay;
+        ticks += (refill < cost->cache_max) ? refill : cost->cache_max;
+    }
+    return ticks;
+}
+
+/**
+ * Round-Robin with context-switch costs. Scheduling is the same as
+ * rr_run, but whenever the CPU switches to a different process the
+ * switch cost (see switch_cost_ticks) is charged with run_overhead first:
+ * every runnable process, including the incoming one, waits for it.
+ * Continuing with the same process costs nothing.
+ *
+ * stats (may be NULL) receives useful and overhead time separately.
+ *
+ * Returns the total time elapsed, overhead included.
+ */
+int rr_run_cost(struct pcb* procs, int plen, int quantum, const struct switch_cost* cost,
+                struct switch_stats* stats) {
+    if (procs == NULL || plen <= 0 || quantum <= 0) {
+        return 0;
+    }
+
+    int* last_ran = malloc(sizeof(int) * plen);
+    if (last_ran == NULL) {
+        return 0;
+    }
+    for (int i = 0; i < plen; i++) {
+        last_ran[i] = -1;
+    }
+
+    struct switch_stats st = { 0, 0, 0 };
+    int total_time = 0;
+    int prev = -1;
+
+    int current = -1;
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            current = i;
+            break;
+        }
+    }
+
+    while (current != -1) {
+        if (current != prev) {
+            bool first_run = (last_ran[current] == -1);
+            int away = first_run ? 0 : total_time - last_ran[current];
+            int ticks = switch_cost_ticks(cost, away, first_run);
+            run_overhead(procs, plen, ticks);
+            total_time += ticks;
+            st.overhead += ticks;
+            st.switches++;
+        }
+
+        int remaining = procs[current].burst_left;
+        int run_time = (remaining < quantum) ? remaining : quantum;
+        run_proc(procs, plen, current, run_time);
+        total_time += run_time;
+        st.useful += run_time;
+        last_ran[current] = total_time;
+
+        prev = current;
+        current = rr_next(current, procs, plen);
+    }
+
+    free(last_ran);
+    if (stats != NULL) {
+        *stats = st;
+    }
+    return total_time;
+}
+
+/**
+ * Ready queue for prio_run: one intrusive FIFO per priority level plus a
+ * bitmap of non-empty levels.
+ *
+ * Levels are stored in a ring so aging every queued process by one level
+ * is a single list splice: logical level L lives in bucket (base + L).
+ */
+struct prio_queue {
+    int* next;                /* FIFO link per PCB index, -1 ends a list */
+    int head[PRIO_LEVELS];
+    int tail[PRIO_LEVELS];
+    uint64_t nonempty;        /* Bit per physical bucket */
+    int base;                 /* Physical bucket holding logical level 0 */
+};
+
+static int prio_clamp(int priority) {
+    if (priority < 0) return 0;
+    if (priority >= PRIO_LEVELS) return PRIO_LEVELS - 1;
+    return priority;
+}
+
+static void pq_push(struct prio_queue* q, int idx, int level) {
+    int b = (q->base + level) % PRIO_LEVELS;
+    q->next[idx] = -1;
+    if (q->head[b] == -1) {
+        q->head[b] = idx;
+    } else {
+        q->next[q->tail[b]] = idx;
+    }
+    q->tail[b] = idx;
+    q->nonempty |= (uint64_t)1 << b;
+}
+
+/** Lowest non-empty logical level, or -1 if the queue is empty. */
+static int pq_min_level(const struct prio_queue* q) {
+    if (q->nonempty == 0) {
+        return -1;
+    }
+    uint64_t rotated = (q->nonempty >> q->base) |
+                       (q->nonempty << ((PRIO_LEVELS - q->base) % PRIO_LEVELS));
+    return __builtin_ctzll(rotated);
+}
+
+static int pq_pop(struct prio_queue* q, int* level) {
+    int lvl = pq_min_level(q);
+    if (lvl == -1) {
+        return -1;
+    }
+
+    int b = (q->base + lvl) % PRIO_LEVELS;
+    int idx = q->head[b];
+    q->head[b] = q->next[idx];
+    if (q->head[b] == -1) {
+        q->nonempty &= ~((uint64_t)1 << b);
+    }
+    *level = lvl;
+    return idx;
+}
+
+/**
+ * Age every queued process by one level. Level 1 is spliced behind
+ * level 0, then the ring rotates so every other level moves down by one.
+ */
+static void pq_age(struct prio_queue* q) {
+    int b0 = q->base;
+    int b1 = (q->base + 1) % PRIO_LEVELS;
+
+    if (q->head[b0] != -1) {
+        if (q->head[b1] == -1) {
+            q->tail[b1] = q->tail[b0];
+        } else {
+            q->next[q->tail[b0]] = q->head[b1];
+        }
+        q->head[b1] = q->head[b0];
+        q->head[b0] = -1;
+        q->nonempty &= ~((uint64_t)1 << b0);
+        q->nonempty |= (uint64_t)1 << b1;
+    }
+    q->base = b1;
+}
+
+/**
+ * Apply every aging epoch that ends at or before `now`. After
+ * PRIO_LEVELS epochs every queued process is at level 0, so the
+ * number of splices is bounded regardless of how long a burst ran.
+ */
+static void pq_age_until(struct prio_queue* q, int now, int aging, long long* next_epoch) {
+    if (aging <= 0 || *next_epoch > now) {
+        return;
+    }
+
+    long long epochs = (now - *next_epoch) / aging + 1;
+    for (long long e = 0; e < epochs && e < PRIO_LEVELS; e++) {
+        pq_age(q);
+    }
+    *next_epoch += epochs * aging;
+}
+
+/**
+ * Run all processes using priority scheduling (0 is the highest priority).
+ * Processes of equal priority run in FCFS order.
+ *
+ * Aging: every `aging` time units, every process in the ready queue moves
+ * up one priority level, so low-priority processes cannot starve. A
+ * process goes back to its own priority once it has been dispatched.
+ * Pass aging <= 0 to disable aging.
+ *
+ * When preemptive, the running process is checked at each aging epoch and
+ * is preempted if a ready process has reached a strictly better level.
+ *
+ * Waits are accumulated lazily (time spent in the ready queue), which
+ * gives the same result as calling run_proc for every slice without
+ * rescanning the PCB array.
+ *
+ * Returns the total time elapsed when all processes are complete.
+ */
+int prio_run(struct pcb* procs, int plen, bool preemptive, int aging) {
+    if (procs == NULL || plen <= 0) {
+        return 0;
+    }
+
+    struct prio_queue q;
+    q.next = malloc(sizeof(int) * plen);
+    int* ready_since = malloc(sizeof(int) * plen);
+    if (q.next == NULL || ready_since == NULL) {
+        free(q.next);
+        free(ready_since);
+        return 0;
+    }
+    for (int b = 0; b < PRIO_LEVELS; b++) {
+        q.head[b] = -1;
+        q.tail[b] = -1;
+    }
+    q.nonempty = 0;
+    q.base = 0;
+
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            pq_push(&q, i, prio_clamp(procs[i].priority));
+            ready_since[i] = 0;
+        }
+    }
+
+    int total_time = 0;
+    long long next_epoch = aging;
+    int level;
+    int current;
+
+    while ((current = pq_pop(&q, &level)) != -1) {
+        procs[current].wait += total_time - ready_since[current];
+
+        if (!preemptive) {
+            total_time += procs[current].burst_left;
+            procs[current].burst_left = 0;
+            pq_age_until(&q, total_time, aging, &next_epoch);
+            continue;
+        }
+
+        while (procs[current].burst_left > 0) {
+            int run_time = procs[current].burst_left;
+            if (aging > 0 && next_epoch - total_time < run_time) {
+                run_time = (int)(next_epoch - total_time);
+            }
+            procs[current].burst_left -= run_time;
+            total_time += run_time;
+            pq_age_until(&q, total_time, aging, &next_epoch);
+
+            int best = pq_min_level(&q);
+            if (procs[current].burst_left > 0 && best != -1 && best < level) {
+                pq_push(&q, current, prio_clamp(procs[current].priority));
+                ready_since[current] = total_time;
+                break;
+            }
+        }
+    }
+
+    free(q.next);
+    free(ready_since);
+    return total_time;
+}
@@ -8,16 +8,42 @@ struct pcb {
     int pid;        /** The process ID */
     int burst_left; /** The amount of burst left */
     int wait;       /** The amount of time this process was stuck waiting */
+    int priority;   /** Scheduling priority, 0 is highest (see PRIO_LEVELS) */
 };
 
+/** Context-switch cost model charged by rr_run_cost */
+struct switch_cost {
+    int dispatch;    /** Fixed overhead of every context switch */
+    int cache_max;   /** Largest cache-refill penalty (also charged on a first run) */
+    int cache_decay; /** Time away from the CPU that costs one tick of refill, 0 disables */
+};
+
+/** Time breakdown reported by rr_run_cost */
+struct switch_stats {
+    int useful;   /** Time spent running processes */
+    int overhead; /** Time spent switching and refilling caches */
+    int switches; /** Number of context switches */
+};
+
+/** Number of distinct priority levels used by prio_run */
+#define PRIO_LEVELS 64
+
 
 struct pcb* init_procs(int* bursts, int blen);
 
 void printall(struct pcb* procs, int plen);
 void run_proc(struct pcb* procs, int plen, int current, int amount);
+void run_overhead(struct pcb* procs, int plen, int amount);
 
 int fcfs_run(struct pcb* procs, int plen);
+int sjf_run(struct pcb* procs, int plen);
 
 int rr_next(int current, struct pcb* procs, int plen);
 int rr_run(struct pcb* procs, int plen, int quantum);
 
+int switch_cost_ticks(const struct switch_cost* cost, int away, bool first_run);
+int rr_run_cost(struct pcb* procs, int plen, int quantum, const struct switch_cost* cost,
+                struct switch_stats* stats);
+
+int prio_run(struct pcb* procs, int plen, bool preemptive, int aging);
+
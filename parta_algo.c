@@ -0,0 +1,295 @@
+#include "parta_algo.h"
+#include "parta_cli.h"
+#include "parta_eevdf.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static bool parse_quantum(const char* arg, int* param) {
+    return parse_int(arg, param) && *param > 0;
+}
+
+static bool parse_aging(const char* arg, int* param) {
+    return parse_int(arg, param) && *param >= 0;
+}
+
+static int run_fcfs(struct pcb* procs, int plen, int param) {
+    (void)param;
+    return fcfs_run(procs, plen);
+}
+
+static int run_sjf(struct pcb* procs, int plen, int param) {
+    (void)param;
+    return sjf_run(procs, plen);
+}
+
+static int run_rr(struct pcb* procs, int plen, int param) {
+    return rr_run(procs, plen, param);
+}
+
+static int run_prio(struct pcb* procs, int plen, int param) {
+    return prio_run(procs, plen, false, param);
+}
+
+static int run_prio_p(struct pcb* procs, int plen, int param) {
+    return prio_run(procs, plen, true, param);
+}
+
+static int run_eevdf(struct pcb* procs, int plen, int param) {
+    return eevdf_run(procs, plen, NULL, param, NULL);
+}
+
+/**
+ * Every scheduler the command-line driver knows about. Adding one is a
+ * single entry here: parsing, initialization and reporting are shared.
+ */
+static const struct sched_algo registry[] = {
+    { "fcfs", "FCFS", 0, NULL, run_fcfs },
+    { "sjf", "SJF", 0, NULL, run_sjf },
+    { "rr", "RR", SCHED_PARAM | SCHED_PREEMPTIVE, parse_quantum, run_rr },
+    { "prio", "PRIO", SCHED_PARAM | SCHED_PRIORITY, parse_aging, run_prio },
+    { "prio-p", "PRIO-P", SCHED_PARAM | SCHED_PRIORITY | SCHED_PREEMPTIVE, parse_aging,
+      run_prio_p },
+    { "eevdf", "EEVDF", SCHED_PARAM | SCHED_PRIORITY | SCHED_PREEMPTIVE, parse_quantum,
+      run_eevdf },
+};
+
+/**
+ * Return the registry, storing the number of entries in *count.
+ */
+const struct sched_algo* sched_algos(int* count) {
+    if (count != NULL) {
+        *count = (int)(sizeof(registry) / sizeof(registry[0]));
+    }
+    return registry;
+}
+
+/**
+ * Look up an algorithm by its command-line name.
+ *
+ * Returns the descriptor, or NULL if there is none.
+ */
+const struct sched_algo* sched_find(const char* name) {
+    if (name == NULL) {
+        return NULL;
+    }
+
+    int count;
+    const struct sched_algo* algos = sched_algos(&count);
+    for (int i = 0; i < count; i++) {
+        if (strcmp(algos[i].name, name) == 0) {
+            return &algos[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Parse an algorithm spec: a name, followed by ":<param>" for algorithms
+ * that take a parameter ("fcfs", "rr:4", "prio-p:2").
+ *
+ * Returns true and fills *spec on success.
+ */
+bool sched_parse_spec(const char* text, struct sched_spec* spec) {
+    if (text == NULL || spec == NULL) {
+        return false;
+    }
+
+    const char* colon = strchr(text, ':');
+    size_t len = (colon != NULL) ? (size_t)(colon - text) : strlen(text);
+    char name[32];
+    if (len == 0 || len >= sizeof(name)) {
+        return false;
+    }
+    memcpy(name, text, len);
+    name[len] = '\0';
+
+    const struct sched_algo* algo = sched_find(name);
+    if (algo == NULL) {
+        return false;
+    }
+
+    spec->algo = algo;
+    spec->param = 0;
+    if (!(algo->flags & SCHED_PARAM)) {
+        return colon == NULL;
+    }
+    return colon != NULL && algo->parse(colon + 1, &spec->param);
+}
+
+/**
+ * Format the report name of a spec, "FCFS" or "RR(4)", into buf.
+ *
+ * Returns the length snprintf would have written.
+ */
+int sched_label(const struct sched_spec* spec, char* buf, size_t len) {
+    if (spec->algo->flags & SCHED_PARAM) {
+        return snprintf(buf, len, "%s(%d)", spec->algo->label, spec->param);
+    }
+    return snprintf(buf, len, "%s", spec->algo->label);
+}
+
+/**
+ * Select the k-th smallest of vals[0..n) (0-based) in expected O(n),
+ * reordering vals.
+ */
+static int select_kth(int* vals, int n, int k) {
+    int lo = 0;
+    int hi = n - 1;
+    while (lo < hi) {
+        int pivot = vals[lo + (hi - lo) / 2];
+        int i = lo;
+        int j = hi;
+        while (i <= j) {
+            while (vals[i] < pivot) {
+                i++;
+            }
+            while (vals[j] > pivot) {
+                j--;
+            }
+            if (i <= j) {
+                int tmp = vals[i];
+                vals[i] = vals[j];
+                vals[j] = tmp;
+                i++;
+                j--;
+            }
+        }
+        if (k <= j) {
+            hi = j;
+        } else if (k >= i) {
+            lo = i;
+        } else {
+            break;
+        }
+    }
+    return vals[k];
+}
+
+/**
+ * Summarize finished PCBs into *result: mean and nearest-rank p99 wait,
+ * with total_time as reported by the scheduler.
+ *
+ * Returns true on success.
+ */
+bool sched_summarize(const struct pcb* procs, int plen, int total_time,
+                     struct sched_result* result) {
+    if (procs == NULL || plen <= 0 || result == NULL) {
+        return false;
+    }
+
+    int* waits = malloc(sizeof(int) * plen);
+    if (waits == NULL) {
+        return false;
+    }
+
+    double sum_wait = 0.0;
+    for (int i = 0; i < plen; i++) {
+        sum_wait += procs[i].wait;
+        waits[i] = procs[i].wait;
+    }
+
+    result->total_time = total_time;
+    result->avg_wait = sum_wait / plen;
+    // Nearest rank: the ceil(0.99 * plen)-th smallest wait.
+    result->p99_wait = select_kth(waits, plen, (int)((99LL * plen + 99) / 100) - 1);
+    free(waits);
+    return true;
+}
+
+/**
+ * Run one spec over a copy of `procs`: the PCBs are copied into
+ * `scratch` (plen entries, may be the same array as procs), run, and
+ * summarized into *result (may be NULL). The scratch array keeps the
+ * final PCBs.
+ *
+ * Returns true on success.
+ */
+bool sched_run(const struct sched_spec* spec, const struct pcb* procs, int plen,
+               struct pcb* scratch, struct sched_result* result) {
+    if (spec == NULL || spec->algo == NULL || procs == NULL || scratch == NULL || plen <= 0) {
+        return false;
+    }
+
+    if (scratch != procs) {
+        memcpy(scratch, procs, sizeof(struct pcb) * plen);
+    }
+    int total_time = spec->algo->run(scratch, plen, spec->param);
+    return result == NULL || sched_summarize(scratch, plen, total_time, result);
+}
+
+/** Work shared by the sched_compare workers */
+struct compare_job {
+    const struct sched_spec* specs;
+    int nspecs;
+    const struct pcb* procs;
+    int plen;
+    struct sched_result* results;
+    int next;   /* Next spec to claim, taken atomically */
+    bool error; /* Set if any run failed */
+};
+
+static void* compare_worker(void* arg) {
+    struct compare_job* job = arg;
+    struct pcb* scratch = malloc(sizeof(struct pcb) * job->plen);
+    if (scratch == NULL) {
+        __atomic_store_n(&job->error, true, __ATOMIC_RELAXED);
+        return NULL;
+    }
+
+    int i;
+    while ((i = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED)) < job->nspecs) {
+        if (!sched_run(&job->specs[i], job->procs, job->plen, scratch, &job->results[i])) {
+            __atomic_store_n(&job->error, true, __ATOMIC_RELAXED);
+        }
+    }
+    free(scratch);
+    return NULL;
+}
+
+/**
+ * Run every spec over its own copy of `procs`, spreading the specs over
+ * up to `threads` threads (0 means one per online CPU). procs is only
+ * read, so the copies are plain memcpy clones; results[i] receives the
+ * outcome of specs[i], independent of which thread ran it.
+ *
+ * Returns true if every run succeeded.
+ */
+bool sched_compare(const struct sched_spec* specs, int nspecs, const struct pcb* procs,
+                   int plen, int threads, struct sched_result* results) {
+    if (specs == NULL || nspecs <= 0 || procs == NULL || plen <= 0 || results == NULL) {
+        return false;
+    }
+
+    if (threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 0) ? (int)cpus : 1;
+    }
+    if (threads > nspecs) {
+        threads = nspecs;
+    }
+
+    struct compare_job job = { specs, nspecs, procs, plen, results, 0, false };
+    pthread_t* tids = malloc(sizeof(pthread_t) * threads);
+    if (tids == NULL) {
+        return false;
+    }
+
+    // The calling thread is worker 0; if a thread cannot be started the
+    // remaining workers simply claim more specs.
+    int started = 0;
+    for (int t = 1; t < threads; t++) {
+        if (pthread_create(&tids[started], NULL, compare_worker, &job) == 0) {
+            started++;
+        }
+    }
+    compare_worker(&job);
+    for (int t = 0; t < started; t++) {
+        pthread_join(tids[t], NULL);
+    }
+
+    free(tids);
+    return !job.error && job.next >= nspecs;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "parta.h"
+
+/** Capability flags of a scheduler descriptor */
+enum sched_flags {
+    SCHED_PARAM = 1 << 0,      /** Takes one integer parameter (quantum, aging, ...) */
+    SCHED_PRIORITY = 1 << 1,   /** Uses the priority of each PCB (bursts as burst:prio) */
+    SCHED_PREEMPTIVE = 1 << 2, /** May take the CPU away before a burst completes */
+};
+
+/** Descriptor of one scheduling algorithm */
+struct sched_algo {
+    const char* name;  /** Name on the command line, e.g. "rr" */
+    const char* label; /** Name in reports, e.g. "RR" */
+    unsigned flags;    /** Bitwise OR of sched_flags */
+    /** Validate the parameter text; NULL when SCHED_PARAM is not set */
+    bool (*parse)(const char* arg, int* param);
+    /** Run the algorithm; returns the total time elapsed */
+    int (*run)(struct pcb* procs, int plen, int param);
+};
+
+/** An algorithm together with its parameter, as parsed from "rr:4" */
+struct sched_spec {
+    const struct sched_algo* algo;
+    int param;
+};
+
+/** Outcome of running one spec over a workload */
+struct sched_result {
+    int total_time;  /** Time when all processes completed */
+    double avg_wait; /** Mean wait over all processes */
+    int p99_wait;    /** 99th percentile wait (nearest rank) */
+};
+
+
+const struct sched_algo* sched_algos(int* count);
+const struct sched_algo* sched_find(const char* name);
+bool sched_parse_spec(const char* text, struct sched_spec* spec);
+int sched_label(const struct sched_spec* spec, char* buf, size_t len);
+
+bool sched_summarize(const struct pcb* procs, int plen, int total_time,
+                     struct sched_result* result);
+bool sched_run(const struct sched_spec* spec, const struct pcb* procs, int plen,
+               struct pcb* scratch, struct sched_result* result);
+bool sched_compare(const struct sched_spec* specs, int nspecs, const struct pcb* procs,
+                   int plen, int threads, struct sched_result* results);
@@ -0,0 +1,255 @@
+#include "parta_branch.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * One PCB plus the time its wait was last brought up to date.
+ * A runnable process that is not running accrues (now - stamp) of wait,
+ * so a slice only has to write the PCB that actually ran.
+ */
+struct branch_entry {
+    struct pcb pcb;
+    int stamp;
+};
+
+struct branch_chunk {
+    int refs;                                 /** Branches sharing this chunk */
+    struct branch_entry ent[BRANCH_CHUNK];
+};
+
+static const struct branch_entry* entry_get(const struct branch* b, int i) {
+    return &b->chunks[i / BRANCH_CHUNK]->ent[i % BRANCH_CHUNK];
+}
+
+/**
+ * Return a writable entry, copying its chunk first if another branch
+ * still shares it. Returns NULL if the copy could not be allocated.
+ */
+static struct branch_entry* entry_get_mut(struct branch* b, int i) {
+    struct branch_chunk* c = b->chunks[i / BRANCH_CHUNK];
+    if (c->refs > 1) {
+        struct branch_chunk* copy = malloc(sizeof(struct branch_chunk));
+        if (copy == NULL) {
+            return NULL;
+        }
+        memcpy(copy->ent, c->ent, sizeof(c->ent));
+        copy->refs = 1;
+        c->refs--;
+        b->chunks[i / BRANCH_CHUNK] = copy;
+        c = copy;
+    }
+    return &c->ent[i % BRANCH_CHUNK];
+}
+
+/** Same rules as rr_next, reading the chunked table instead of an array. */
+static int branch_next(const struct branch* b, int current) {
+    int start = (current + 1) % b->plen;
+    for (int offset = 0; offset < b->plen; offset++) {
+        int idx = (start + offset) % b->plen;
+        if (entry_get(b, idx)->pcb.burst_left > 0) {
+            return idx;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Create a Round-Robin simulation at time 0 from an array of CPU bursts.
+ * PCBs start out exactly as init_procs would build them.
+ *
+ * Returns the new branch (free with branch_free), or NULL on failure.
+ */
+struct branch* branch_create(int* bursts, int blen, int quantum) {
+    if (blen <= 0 || bursts == NULL || quantum <= 0) {
+        return NULL;
+    }
+
+    struct branch* b = calloc(1, sizeof(struct branch));
+    if (b == NULL) {
+        return NULL;
+    }
+    b->plen = blen;
+    b->quantum = quantum;
+    b->nchunks = (blen + BRANCH_CHUNK - 1) / BRANCH_CHUNK;
+    b->chunks = calloc(b->nchunks, sizeof(struct branch_chunk*));
+    if (b->chunks == NULL) {
+        free(b);
+        return NULL;
+    }
+
+    for (int c = 0; c < b->nchunks; c++) {
+        b->chunks[c] = calloc(1, sizeof(struct branch_chunk));
+        if (b->chunks[c] == NULL) {
+            branch_free(b);
+            return NULL;
+        }
+        b->chunks[c]->refs = 1;
+    }
+
+    for (int i = 0; i < blen; i++) {
+        struct branch_entry* e = &b->chunks[i / BRANCH_CHUNK]->ent[i % BRANCH_CHUNK];
+        e->pcb.pid = i;
+        e->pcb.burst_left = bursts[i];
+        e->pcb.wait = 0;
+        e->stamp = 0;
+    }
+
+    // Same starting point as rr_run: the first process with work.
+    b->current = (bursts[0] > 0) ? 0 : branch_next(b, 0);
+    return b;
+}
+
+/**
+ * Fork a branch. The child shares every chunk with its parent; only the
+ * chunk directory is copied, so the cost is O(plen / BRANCH_CHUNK).
+ *
+ * Returns the new branch, or NULL on failure.
+ */
+struct branch* branch_fork(const struct branch* parent) {
+    if (parent == NULL) {
+        return NULL;
+    }
+
+    struct branch* b = malloc(sizeof(struct branch));
+    if (b == NULL) {
+        return NULL;
+    }
+    *b = *parent;
+    b->chunks = malloc(sizeof(struct branch_chunk*) * parent->nchunks);
+    if (b->chunks == NULL) {
+        free(b);
+        return NULL;
+    }
+
+    for (int c = 0; c < parent->nchunks; c++) {
+        b->chunks[c] = parent->chunks[c];
+        b->chunks[c]->refs++;
+    }
+    return b;
+}
+
+/**
+ * Release a branch. Chunks are freed once no other branch shares them.
+ */
+void branch_free(struct branch* b) {
+    if (b == NULL) {
+        return;
+    }
+
+    for (int c = 0; c < b->nchunks; c++) {
+        struct branch_chunk* chunk = b->chunks[c];
+        if (chunk != NULL && --chunk->refs == 0) {
+            free(chunk);
+        }
+    }
+    free(b->chunks);
+    free(b);
+}
+
+/**
+ * Change the time quantum used from the next slice onwards.
+ */
+void branch_set_quantum(struct branch* b, int quantum) {
+    if (b == NULL || quantum <= 0) {
+        return;
+    }
+    b->quantum = quantum;
+}
+
+/**
+ * Run a single Round-Robin slice: the current process runs for
+ * min(quantum, burst_left), then the next process is chosen as in rr_next.
+ *
+ * Returns the length of the slice, or 0 if every process is complete
+ * (or a chunk copy failed).
+ */
+int branch_step(struct branch* b) {
+    if (b == NULL || b->current < 0) {
+        return 0;
+    }
+
+    struct branch_entry* e = entry_get_mut(b, b->current);
+    if (e == NULL) {
+        return 0;
+    }
+
+    int run_time = e->pcb.burst_left;
+    if (b->quantum < run_time) {
+        run_time = b->quantum;
+    }
+
+    e->pcb.wait += b->time - e->stamp;
+    e->pcb.burst_left -= run_time;
+    b->time += run_time;
+    e->stamp = b->time;
+
+    b->current = branch_next(b, b->current);
+    return run_time;
+}
+
+/**
+ * Run slices until the simulated time reaches at least `until`, or every
+ * process is complete. Slices are never split, so the time may overshoot.
+ *
+ * Returns the simulated time afterwards.
+ */
+int branch_run_until(struct branch* b, int until) {
+    if (b == NULL) {
+        return 0;
+    }
+
+    while (b->time < until && branch_step(b) > 0) {
+    }
+    return b->time;
+}
+
+/**
+ * Run until every process is complete.
+ *
+ * Returns the total time elapsed, as rr_run does.
+ */
+int branch_run(struct branch* b) {
+    if (b == NULL) {
+        return 0;
+    }
+
+    while (branch_step(b) > 0) {
+    }
+    return b->time;
+}
+
+/**
+ * Write the current PCBs of a branch into `out` (plen entries), with
+ * each wait brought up to the branch's current time.
+ */
+void branch_export(const struct branch* b, struct pcb* out) {
+    if (b == NULL || out == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < b->plen; i++) {
+        const struct branch_entry* e = entry_get(b, i);
+        out[i] = e->pcb;
+        if (e->pcb.burst_left > 0) {
+            out[i].wait += b->time - e->stamp;
+        }
+    }
+}
+
+/**
+ * Count the chunks owned only by this branch, i.e. how much memory its
+ * divergence from the other branches costs.
+ */
+int branch_private_chunks(const struct branch* b) {
+    if (b == NULL) {
+        return 0;
+    }
+
+    int count = 0;
+    for (int c = 0; c < b->nchunks; c++) {
+        if (b->chunks[c]->refs == 1) {
+            count++;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "parta.h"
+
+/** Number of PCBs stored in each copy-on-write chunk */
+#define BRANCH_CHUNK 256
+
+/** A fixed-size, reference-counted slice of the PCB table */
+struct branch_chunk;
+
+/**
+ * A mid-run Round-Robin simulation that can be forked cheaply.
+ *
+ * The PCB table is split into chunks that are shared between forks and
+ * only copied when one fork writes to them, so many "what-if"
+ * continuations share their common prefix.
+ */
+struct branch {
+    struct branch_chunk** chunks; /** Chunk directory, owned by this branch */
+    int nchunks;                  /** Number of entries in chunks */
+    int plen;                     /** Number of processes */
+    int quantum;                  /** Time quantum used for the next slices */
+    int current;                  /** Next process to dispatch, -1 when done */
+    int time;                     /** Simulated time elapsed so far */
+};
+
+
+struct branch* branch_create(int* bursts, int blen, int quantum);
+struct branch* branch_fork(const struct branch* parent);
+void branch_free(struct branch* b);
+
+void branch_set_quantum(struct branch* b, int quantum);
+int branch_step(struct branch* b);
+int branch_run_until(struct branch* b, int until);
+int branch_run(struct branch* b);
+
+void branch_export(const struct branch* b, struct pcb* out);
+int branch_private_chunks(const struct branch* b);
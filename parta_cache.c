@@ -0,0 +1,522 @@
+#include "parta_cache.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define PRIME64_1 0x9E3779B185EBCA87ULL
+#define PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define PRIME64_3 0x165667B19E3779F9ULL
+#define PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define PRIME64_5 0x27D4EB2F165667C5ULL
+
+/** Magic number at the start of every on-disk entry ("PRC1") */
+#define CACHE_MAGIC 0x31435250u
+
+/** Bytes of algorithm name stored in an on-disk entry */
+#define CACHE_NAME_LEN 16
+
+static inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t read64(const unsigned char* p) {
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return v;
+}
+
+static inline uint32_t read32(const unsigned char* p) {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static inline uint64_t xxh_round(uint64_t acc, uint64_t input) {
+    acc += input * PRIME64_2;
+    acc = rotl64(acc, 31);
+    return acc * PRIME64_1;
+}
+
+static inline uint64_t xxh_merge(uint64_t acc, uint64_t val) {
+    acc ^= xxh_round(0, val);
+    return acc * PRIME64_1 + PRIME64_4;
+}
+
+/**
+ * 64-bit hash of `len` bytes, computed as XXH64 (little-endian hosts
+ * produce the reference values). Four independent lanes consume 32
+ * bytes per step, so long burst vectors hash at memory speed.
+ */
+uint64_t parta_hash64(const void* data, size_t len, uint64_t seed) {
+    const unsigned char* p = data;
+    const unsigned char* end = p + len;
+    uint64_t h;
+
+    if (len >= 32) {
+        uint64_t v1 = seed + PRIME64_1 + PRIME64_2;
+        uint64_t v2 = seed + PRIME64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - PRIME64_1;
+        const unsigned char* limit = end - 32;
+        do {
+            v1 = xxh_round(v1, read64(p));
+            v2 = xxh_round(v2, read64(p + 8));
+            v3 = xxh_round(v3, read64(p + 16));
+            v4 = xxh_round(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        h = xxh_merge(h, v1);
+        h = xxh_merge(h, v2);
+        h = xxh_merge(h, v3);
+        h = xxh_merge(h, v4);
+    } else {
+        h = seed + PRIME64_5;
+    }
+    h += (uint64_t)len;
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= xxh_round(0, read64(p));
+        h = rotl64(h, 27) * PRIME64_1 + PRIME64_4;
+    }
+    if (p + 4 <= end) {
+        h ^= (uint64_t)read32(p) * PRIME64_1;
+        h = rotl64(h, 23) * PRIME64_2 + PRIME64_3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= (*p) * PRIME64_5;
+        h = rotl64(h, 11) * PRIME64_1;
+    }
+
+    h ^= h >> 33;
+    h *= PRIME64_2;
+    h ^= h >> 29;
+    h *= PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+/**
+ * A memoized run. The key is (algorithm, param, plen, bursts, and
+ * priorities for algorithms that use them); the value is what the run
+ * adds to each wait, plus the total time.
+ */
+struct cache_entry {
+    uint64_t hash;
+    const struct sched_algo* algo;
+    int* key;   /* klen ints: param, plen, bursts[, priorities] */
+    int klen;
+    int* waits; /* plen wait deltas */
+    int plen;
+    int total_time;
+    size_t bytes;
+    struct cache_entry* chain; /* Next entry in the same bucket */
+    struct cache_entry* prev;  /* LRU list, most recent first */
+    struct cache_entry* next;
+};
+
+struct result_cache {
+    pthread_mutex_t lock;
+    struct cache_entry** buckets;
+    size_t nbuckets; /* Power of two */
+    struct cache_entry* lru_head;
+    struct cache_entry* lru_tail;
+    size_t max_bytes;
+    char* dir;
+    unsigned tmp_seq; /* Unique suffix for on-disk temporaries */
+    struct cache_stats stats;
+};
+
+/**
+ * Create a cache holding at most `max_bytes` of entries in memory
+ * (least recently used entries are evicted first). If `dir` is not
+ * NULL, every result is also stored there, one file per entry, and
+ * memory misses are looked up on disk before running the scheduler.
+ *
+ * Returns the cache (free with cache_free), or NULL on failure.
+ */
+struct result_cache* cache_create(size_t max_bytes, const char* dir) {
+    struct result_cache* c = calloc(1, sizeof(struct result_cache));
+    if (c == NULL) {
+        return NULL;
+    }
+    c->nbuckets = 64;
+    c->buckets = calloc(c->nbuckets, sizeof(struct cache_entry*));
+    c->dir = (dir != NULL) ? strdup(dir) : NULL;
+    if (c->buckets == NULL || (dir != NULL && c->dir == NULL)) {
+        free(c->buckets);
+        free(c->dir);
+        free(c);
+        return NULL;
+    }
+    c->max_bytes = max_bytes;
+    pthread_mutex_init(&c->lock, NULL);
+    return c;
+}
+
+static void entry_free(struct cache_entry* e) {
+    free(e->key);
+    free(e->waits);
+    free(e);
+}
+
+void cache_free(struct result_cache* c) {
+    if (c == NULL) {
+        return;
+    }
+    for (struct cache_entry* e = c->lru_head; e != NULL;) {
+        struct cache_entry* next = e->next;
+        entry_free(e);
+        e = next;
+    }
+    pthread_mutex_destroy(&c->lock);
+    free(c->buckets);
+    free(c->dir);
+    free(c);
+}
+
+/**
+ * Build the lookup key of a run and its hash.
+ *
+ * Returns the key (klen ints, caller frees), or NULL on failure.
+ */
+static int* make_key(const struct sched_spec* spec, const struct pcb* procs, int plen,
+                     int* klen, uint64_t* hash) {
+    bool prio = (spec->algo->flags & SCHED_PRIORITY) != 0;
+    *klen = 2 + plen * (prio ? 2 : 1);
+    int* key = malloc(sizeof(int) * *klen);
+    if (key == NULL) {
+        return NULL;
+    }
+
+    key[0] = spec->param;
+    key[1] = plen;
+    for (int i = 0; i < plen; i++) {
+        key[2 + i] = procs[i].burst_left;
+    }
+    for (int i = 0; prio && i < plen; i++) {
+        key[2 + plen + i] = procs[i].priority;
+    }
+
+    uint64_t seed = parta_hash64(spec->algo->name, strlen(spec->algo->name), 0);
+    *hash = parta_hash64(key, sizeof(int) * *klen, seed);
+    return key;
+}
+
+static bool entry_matches(const struct cache_entry* e, uint64_t hash,
+                          const struct sched_algo* algo, const int* key, int klen) {
+    return e->hash == hash && e->algo == algo && e->klen == klen &&
+           memcmp(e->key, key, sizeof(int) * klen) == 0;
+}
+
+static void lru_unlink(struct result_cache* c, struct cache_entry* e) {
+    if (e->prev != NULL) {
+        e->prev->next = e->next;
+    } else {
+        c->lru_head = e->next;
+    }
+    if (e->next != NULL) {
+        e->next->prev = e->prev;
+    } else {
+        c->lru_tail = e->prev;
+    }
+}
+
+static void lru_push_front(struct result_cache* c, struct cache_entry* e) {
+    e->prev = NULL;
+    e->next = c->lru_head;
+    if (c->lru_head != NULL) {
+        c->lru_head->prev = e;
+    } else {
+        c->lru_tail = e;
+    }
+    c->lru_head = e;
+}
+
+/** Find an entry and mark it most recently used. Caller holds the lock. */
+static struct cache_entry* cache_lookup(struct result_cache* c, uint64_t hash,
+                                        const struct sched_algo* algo, const int* key,
+                                        int klen) {
+    struct cache_entry* e = c->buckets[hash & (c->nbuckets - 1)];
+    while (e != NULL && !entry_matches(e, hash, algo, key, klen)) {
+        e = e->chain;
+    }
+    if (e != NULL && e != c->lru_head) {
+        lru_unlink(c, e);
+        lru_push_front(c, e);
+    }
+    return e;
+}
+
+static void bucket_remove(struct result_cache* c, struct cache_entry* e) {
+    struct cache_entry** link = &c->buckets[e->hash & (c->nbuckets - 1)];
+    while (*link != e) {
+        link = &(*link)->chain;
+    }
+    *link = e->chain;
+}
+
+static void cache_grow(struct result_cache* c) {
+    size_t nbuckets = c->nbuckets * 2;
+    struct cache_entry** buckets = calloc(nbuckets, sizeof(struct cache_entry*));
+    if (buckets == NULL) {
+        return; // Keep the old table; chains just get longer.
+    }
+    for (struct cache_entry* e = c->lru_head; e != NULL; e = e->next) {
+        size_t b = e->hash & (nbuckets - 1);
+        e->chain = buckets[b];
+        buckets[b] = e;
+    }
+    free(c->buckets);
+    c->buckets = buckets;
+    c->nbuckets = nbuckets;
+}
+
+/**
+ * Insert an entry (taking ownership) unless an equal one is already
+ * there, then evict from the LRU tail until the budget is met. Caller
+ * holds the lock.
+ */
+static void cache_insert(struct result_cache* c, struct cache_entry* e) {
+    if (e->bytes > c->max_bytes ||
+        cache_lookup(c, e->hash, e->algo, e->key, e->klen) != NULL) {
+        entry_free(e);
+        return;
+    }
+
+    if ((size_t)c->stats.entries >= c->nbuckets) {
+        cache_grow(c);
+    }
+    size_t b = e->hash & (c->nbuckets - 1);
+    e->chain = c->buckets[b];
+    c->buckets[b] = e;
+    lru_push_front(c, e);
+    c->stats.entries++;
+    c->stats.bytes += e->bytes;
+
+    while (c->stats.bytes > c->max_bytes) {
+        struct cache_entry* victim = c->lru_tail;
+        lru_unlink(c, victim);
+        bucket_remove(c, victim);
+        c->stats.entries--;
+        c->stats.bytes -= victim->bytes;
+        c->stats.evictions++;
+        entry_free(victim);
+    }
+}
+
+static struct cache_entry* entry_new(uint64_t hash, const struct sched_algo* algo, int* key,
+                                     int klen, int plen) {
+    struct cache_entry* e = calloc(1, sizeof(struct cache_entry));
+    int* waits = malloc(sizeof(int) * plen);
+    if (e == NULL || waits == NULL) {
+        free(e);
+        free(waits);
+        return NULL;
+    }
+    e->hash = hash;
+    e->algo = algo;
+    e->key = key;
+    e->klen = klen;
+    e->waits = waits;
+    e->plen = plen;
+    e->bytes = sizeof(struct cache_entry) + sizeof(int) * ((size_t)klen + plen);
+    return e;
+}
+
+static void disk_path(const struct result_cache* c, uint64_t hash, char* buf, size_t len) {
+    snprintf(buf, len, "%s/%016llx.prc", c->dir, (unsigned long long)hash);
+}
+
+/**
+ * Load an entry from the on-disk store. The stored key must match, so a
+ * hash collision reads as a miss.
+ *
+ * Returns the entry (owning a copy of key), or NULL.
+ */
+static struct cache_entry* disk_load(struct result_cache* c, uint64_t hash,
+                                     const struct sched_algo* algo, const int* key, int klen,
+                                     int plen) {
+    char path[4096];
+    disk_path(c, hash, path, sizeof(path));
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) {
+        return NULL;
+    }
+
+    int* copy = malloc(sizeof(int) * klen);
+    struct cache_entry* e = (copy != NULL) ? entry_new(hash, algo, copy, klen, plen) : NULL;
+    if (e == NULL) {
+        free(copy);
+        fclose(f);
+        return NULL;
+    }
+
+    // The name field is fixed-width and need not be NUL-terminated in a
+    // corrupt file: compare it whole against the padded name disk_store
+    // would write.
+    uint32_t magic;
+    char name[CACHE_NAME_LEN];
+    char want[CACHE_NAME_LEN] = { 0 };
+    strncpy(want, algo->name, sizeof(want) - 1);
+    int header[2];
+    bool ok = fread(&magic, sizeof(magic), 1, f) == 1 && magic == CACHE_MAGIC &&
+              fread(name, sizeof(name), 1, f) == 1 && memcmp(name, want, sizeof(name)) == 0 &&
+              fread(header, sizeof(header), 1, f) == 1 && header[0] == klen &&
+              header[1] == plen && fread(copy, sizeof(int), klen, f) == (size_t)klen &&
+              memcmp(copy, key, sizeof(int) * klen) == 0 &&
+              fread(&e->total_time, sizeof(int), 1, f) == 1 &&
+              fread(e->waits, sizeof(int), plen, f) == (size_t)plen;
+    fclose(f);
+    if (!ok) {
+        entry_free(e);
+        return NULL;
+    }
+    return e;
+}
+
+/**
+ * Write an entry to the on-disk store: into a temporary file first,
+ * renamed into place so readers never see a partial entry.
+ */
+static void disk_store(struct result_cache* c, const struct cache_entry* e) {
+    char path[4096];
+    char tmp[4200];
+    disk_path(c, e->hash, path, sizeof(path));
+    unsigned seq = __atomic_fetch_add(&c->tmp_seq, 1, __ATOMIC_RELAXED);
+    snprintf(tmp, sizeof(tmp), "%s.%d.%u.tmp", path, (int)getpid(), seq);
+
+    FILE* f = fopen(tmp, "wb");
+    if (f == NULL) {
+        return;
+    }
+    uint32_t magic = CACHE_MAGIC;
+    char name[CACHE_NAME_LEN] = { 0 };
+    strncpy(name, e->algo->name, sizeof(name) - 1);
+    int header[2] = { e->klen, e->plen };
+    bool ok = fwrite(&magic, sizeof(magic), 1, f) == 1 && fwrite(name, sizeof(name), 1, f) == 1 &&
+              fwrite(header, sizeof(header), 1, f) == 1 &&
+              fwrite(e->key, sizeof(int), e->klen, f) == (size_t)e->klen &&
+              fwrite(&e->total_time, sizeof(int), 1, f) == 1 &&
+              fwrite(e->waits, sizeof(int), e->plen, f) == (size_t)e->plen;
+    ok = (fclose(f) == 0) && ok;
+    if (!ok || rename(tmp, path) != 0) {
+        unlink(tmp);
+    }
+}
+
+/** Replay a memoized run onto procs. */
+static int entry_apply(const struct cache_entry* e, struct pcb* procs) {
+    for (int i = 0; i < e->plen; i++) {
+        procs[i].wait += e->waits[i];
+        if (procs[i].burst_left > 0) {
+            procs[i].burst_left = 0;
+        }
+    }
+    return e->total_time;
+}
+
+/**
+ * Run `spec` over procs like its run function would, answering from the
+ * cache when the same (algorithm, parameter, bursts) was seen before. A
+ * hit costs one pass to hash and compare the key plus one to apply the
+ * waits. Every scheduler runs each process to completion, so only the
+ * wait each run adds needs to be remembered.
+ *
+ * c may be NULL to run without caching. Safe to call from several
+ * threads at once.
+ *
+ * Returns the total time elapsed when all processes are complete.
+ */
+int cache_run(struct result_cache* c, const struct sched_spec* spec, struct pcb* procs, int plen) {
+    if (spec == NULL || spec->algo == NULL || procs == NULL || plen <= 0) {
+        return 0;
+    }
+
+    int klen;
+    uint64_t hash;
+    int* key = (c != NULL) ? make_key(spec, procs, plen, &klen, &hash) : NULL;
+    if (key == NULL) {
+        return spec->algo->run(procs, plen, spec->param);
+    }
+
+    pthread_mutex_lock(&c->lock);
+    struct cache_entry* e = cache_lookup(c, hash, spec->algo, key, klen);
+    if (e != NULL) {
+        int total_time = entry_apply(e, procs);
+        c->stats.hits++;
+        pthread_mutex_unlock(&c->lock);
+        free(key);
+        return total_time;
+    }
+    pthread_mutex_unlock(&c->lock);
+
+    e = (c->dir != NULL) ? disk_load(c, hash, spec->algo, key, klen, plen) : NULL;
+    if (e != NULL) {
+        free(key);
+        int total_time = entry_apply(e, procs);
+        pthread_mutex_lock(&c->lock);
+        c->stats.hits++;
+        c->stats.disk_hits++;
+        cache_insert(c, e);
+        pthread_mutex_unlock(&c->lock);
+        return total_time;
+    }
+
+    // Miss: run for real, remembering what the run adds to each wait.
+    e = entry_new(hash, spec->algo, key, klen, plen);
+    if (e == NULL) {
+        free(key);
+        return spec->algo->run(procs, plen, spec->param);
+    }
+    for (int i = 0; i < plen; i++) {
+        e->waits[i] = procs[i].wait;
+    }
+    e->total_time = spec->algo->run(procs, plen, spec->param);
+    for (int i = 0; i < plen; i++) {
+        e->waits[i] = procs[i].wait - e->waits[i];
+    }
+
+    if (c->dir != NULL) {
+        disk_store(c, e);
+    }
+    int total_time = e->total_time;
+    pthread_mutex_lock(&c->lock);
+    c->stats.misses++;
+    cache_insert(c, e);
+    pthread_mutex_unlock(&c->lock);
+    return total_time;
+}
+
+/**
+ * sched_run through the cache: copy procs into scratch, run (or replay)
+ * the spec and summarize into *result (may be NULL).
+ *
+ * Returns true on success.
+ */
+bool cache_sched_run(struct result_cache* c, const struct sched_spec* spec,
+                     const struct pcb* procs, int plen, struct pcb* scratch,
+                     struct sched_result* result) {
+    if (spec == NULL || spec->algo == NULL || procs == NULL || scratch == NULL || plen <= 0) {
+        return false;
+    }
+
+    if (scratch != procs) {
+        memcpy(scratch, procs, sizeof(struct pcb) * plen);
+    }
+    int total_time = cache_run(c, spec, scratch, plen);
+    return result == NULL || sched_summarize(scratch, plen, total_time, result);
+}
+
+/**
+ * Copy the cache counters into *stats.
+ */
+void cache_stats(struct result_cache* c, struct cache_stats* stats) {
+    pthread_mutex_lock(&c->lock);
+    *stats = c->stats;
+    pthread_mutex_unlock(&c->lock);
+}
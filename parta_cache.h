@@ -0,0 +1,28 @@
+#pragma once
+
+#include "parta_algo.h"
+#include <stdint.h>
+
+/** Counters reported by cache_stats */
+struct cache_stats {
+    long long hits;      /** Lookups answered from memory or disk */
+    long long disk_hits; /** Of those, answers loaded from the on-disk store */
+    long long misses;    /** Lookups that had to run the scheduler */
+    long long evictions; /** Entries dropped from memory to stay under budget */
+    long long entries;   /** Entries currently in memory */
+    size_t bytes;        /** Memory currently charged to entries */
+};
+
+struct result_cache;
+
+
+uint64_t parta_hash64(const void* data, size_t len, uint64_t seed);
+
+struct result_cache* cache_create(size_t max_bytes, const char* dir);
+void cache_free(struct result_cache* c);
+
+int cache_run(struct result_cache* c, const struct sched_spec* spec, struct pcb* procs, int plen);
+bool cache_sched_run(struct result_cache* c, const struct sched_spec* spec,
+                     const struct pcb* procs, int plen, struct pcb* scratch,
+                     struct sched_result* result);
+void cache_stats(struct result_cache* c, struct cache_stats* stats);
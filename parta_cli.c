@@ -0,0 +1,197 @@
+#include "parta_cli.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <unistd.h>
+
+/**
+ * Strictly parse a decimal int: optional sign, at least one digit and
+ * nothing after it. Unlike atoi, garbage and out-of-range values are
+ * rejected instead of turning into 0.
+ *
+ * Returns true and stores the value in *out on success.
+ */
+bool parse_int(const char* s, int* out) {
+    if (s == NULL || *s == '\0') {
+        return false;
+    }
+
+    const char* p = s;
+    bool negative = false;
+    if (*p == '+' || *p == '-') {
+        negative = (*p == '-');
+        p++;
+    }
+    if (*p < '0' || *p > '9') {
+        return false;
+    }
+
+    long long value = 0;
+    for (; *p >= '0' && *p <= '9'; p++) {
+        value = value * 10 + (*p - '0');
+        if (value > (long long)INT_MAX + 1) {
+            return false;
+        }
+    }
+    if (*p != '\0') {
+        return false;
+    }
+
+    value = negative ? -value : value;
+    if (value > INT_MAX || value < INT_MIN) {
+        return false;
+    }
+    *out = (int)value;
+    return true;
+}
+
+/**
+ * Parse a burst given as "burst" or "burst:prio". The priority defaults
+ * to 0 and priority may be NULL if the caller does not accept one.
+ *
+ * Returns true on success.
+ */
+bool parse_burst(const char* s, int* burst, int* priority) {
+    if (s == NULL) {
+        return false;
+    }
+
+    const char* colon = strchr(s, ':');
+    if (colon == NULL) {
+        if (priority != NULL) {
+            *priority = 0;
+        }
+        return parse_int(s, burst);
+    }
+    if (priority == NULL || colon - s >= 16) {
+        return false;
+    }
+
+    char head[16];
+    memcpy(head, s, colon - s);
+    head[colon - s] = '\0';
+    return parse_int(head, burst) && parse_int(colon + 1, priority);
+}
+
+/**
+ * Start an output buffer for `fd` with `cap` bytes reserved up front.
+ */
+void out_init(struct out_buf* out, int fd, size_t cap) {
+    out->fd = fd;
+    out->len = 0;
+    out->cap = (cap > 0) ? cap : 4096;
+    out->buf = malloc(out->cap);
+    out->err = (out->buf == NULL);
+    if (out->err) {
+        out->cap = 0;
+    }
+}
+
+static bool out_reserve(struct out_buf* out, size_t extra) {
+    if (out->err) {
+        return false;
+    }
+    if (out->len + extra <= out->cap) {
+        return true;
+    }
+
+    size_t cap = out->cap * 2;
+    while (cap < out->len + extra) {
+        cap *= 2;
+    }
+    char* buf = realloc(out->buf, cap);
+    if (buf == NULL) {
+        out->err = true;
+        return false;
+    }
+    out->buf = buf;
+    out->cap = cap;
+    return true;
+}
+
+void out_char(struct out_buf* out, char c) {
+    if (out_reserve(out, 1)) {
+        out->buf[out->len++] = c;
+    }
+}
+
+void out_str(struct out_buf* out, const char* s) {
+    size_t n = strlen(s);
+    if (out_reserve(out, n)) {
+        memcpy(out->buf + out->len, s, n);
+        out->len += n;
+    }
+}
+
+/**
+ * Append a decimal integer without going through printf: digits are
+ * produced backwards into a small scratch buffer, then copied.
+ */
+void out_ll(struct out_buf* out, long long value) {
+    char tmp[21];
+    int pos = sizeof(tmp);
+    unsigned long long u = (value < 0) ? 0ull - (unsigned long long)value : (unsigned long long)value;
+
+    do {
+        tmp[--pos] = (char)('0' + u % 10);
+        u /= 10;
+    } while (u != 0);
+    if (value < 0) {
+        tmp[--pos] = '-';
+    }
+
+    if (out_reserve(out, sizeof(tmp) - pos)) {
+        memcpy(out->buf + out->len, tmp + pos, sizeof(tmp) - pos);
+        out->len += sizeof(tmp) - pos;
+    }
+}
+
+void out_int(struct out_buf* out, int value) {
+    out_ll(out, value);
+}
+
+/**
+ * Append a value rounded to 2 decimal places exactly as printf("%.2f")
+ * does, ties included (0.125 is "0.12"), so single runs and the compare
+ * table print the same digits.
+ */
+void out_fixed2(struct out_buf* out, double value) {
+    char tmp[64];
+    int n = snprintf(tmp, sizeof(tmp), "%.2f", value);
+    if (n > 0 && (size_t)n < sizeof(tmp) && out_reserve(out, (size_t)n)) {
+        memcpy(out->buf + out->len, tmp, (size_t)n);
+        out->len += (size_t)n;
+    }
+}
+
+/**
+ * Write everything buffered with as few write calls as the kernel
+ * allows (normally one), then empty the buffer.
+ *
+ * Returns false if anything failed since out_init.
+ */
+bool out_flush(struct out_buf* out) {
+    size_t done = 0;
+    while (!out->err && done < out->len) {
+        ssize_t n = write(out->fd, out->buf + done, out->len - done);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            out->err = true;
+            break;
+        }
+        done += (size_t)n;
+    }
+    out->len = 0;
+    return !out->err;
+}
+
+void out_free(struct out_buf* out) {
+    free(out->buf);
+    out->buf = NULL;
+    out->len = 0;
+    out->cap = 0;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Growable output buffer flushed to a file descriptor with write(2) */
+struct out_buf {
+    char* buf;  /** Buffered bytes */
+    size_t len; /** Bytes currently buffered */
+    size_t cap; /** Allocated size of buf */
+    int fd;     /** Destination file descriptor */
+    bool err;   /** Set once an allocation or write has failed */
+};
+
+
+bool parse_int(const char* s, int* out);
+bool parse_burst(const char* s, int* burst, int* priority);
+
+void out_init(struct out_buf* out, int fd, size_t cap);
+void out_char(struct out_buf* out, char c);
+void out_str(struct out_buf* out, const char* s);
+void out_int(struct out_buf* out, int value);
+void out_ll(struct out_buf* out, long long value);
+void out_fixed2(struct out_buf* out, double value);
+bool out_flush(struct out_buf* out);
+void out_free(struct out_buf* out);
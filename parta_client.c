@@ -0,0 +1,103 @@
+#include "parta_server.h"
+#include "parta_cli.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+static void usage(void) {
+    printf("Usage: parta_client <socket> [-n <count>] <algo[:param]> <burst1[:prio1]> ...\n");
+}
+
+/**
+ * Client for `parta_main serve`.
+ *
+ * Sends the workload `count` times (default 1) as pipelined requests on
+ * one connection, then reads every response. Prints the result of the
+ * first request, and the request rate when count > 1.
+ */
+int main(int argc, char* argv[]) {
+    int count = 1;
+    int arg = 2;
+    if (argc > 3 && strcmp(argv[2], "-n") == 0) {
+        if (!parse_int(argv[3], &count) || count <= 0) {
+            usage();
+            return 1;
+        }
+        arg = 4;
+    }
+    if (argc < arg + 2) {
+        usage();
+        return 1;
+    }
+
+    struct sched_spec spec;
+    if (!sched_parse_spec(argv[arg], &spec)) {
+        printf("ERROR: Invalid argument '%s'\n", argv[arg]);
+        return 1;
+    }
+
+    struct srv_request req = { 0 };
+    strncpy(req.algo, spec.algo->name, SRV_ALGO_LEN - 1);
+    req.param = spec.param;
+    req.plen = (uint32_t)(argc - arg - 1);
+
+    int* bursts = malloc(sizeof(int) * req.plen);
+    int* prios = malloc(sizeof(int) * req.plen);
+    if (bursts == NULL || prios == NULL) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        return 1;
+    }
+    for (uint32_t i = 0; i < req.plen; i++) {
+        if (!parse_burst(argv[arg + 1 + i], &bursts[i], &prios[i])) {
+            printf("ERROR: Invalid argument '%s'\n", argv[arg + 1 + i]);
+            return 1;
+        }
+    }
+
+    int fd = srv_connect(argv[1]);
+    if (fd < 0) {
+        fprintf(stderr, "ERROR: Cannot connect to %s\n", argv[1]);
+        return 1;
+    }
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < count; i++) {
+        req.req_id = (uint32_t)i;
+        if (!srv_send(fd, &req, bursts, prios)) {
+            fprintf(stderr, "ERROR: Send failed\n");
+            return 1;
+        }
+    }
+
+    struct srv_response first = { 0 };
+    for (int i = 0; i < count; i++) {
+        struct srv_response resp;
+        if (!srv_recv(fd, &resp)) {
+            fprintf(stderr, "ERROR: Receive failed\n");
+            return 1;
+        }
+        if (resp.req_id == 0) {
+            first = resp;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    close(fd);
+    free(bursts);
+    free(prios);
+
+    if (first.status != SRV_OK) {
+        printf("ERROR: Server returned status %d\n", (int)first.status);
+        return 1;
+    }
+    printf("Average wait time: %.2f\n", first.avg_wait);
+    printf("P99 wait time: %d\n", (int)first.p99_wait);
+    printf("Total time: %d\n", (int)first.total_time);
+    if (count > 1) {
+        double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+        printf("%d requests in %.3f s (%.0f/s)\n", count, secs, count / secs);
+    }
+    return 0;
+}
@@ -0,0 +1,227 @@
+#include "parta_coro.h"
+#include <stdlib.h>
+
+/** Blocked process, ordered by (wake-up time, pid) */
+struct coro_block {
+    int until;
+    int pid;
+};
+
+/**
+ * Scheduler core state: a FIFO ready queue (a process is queued at most
+ * once, so a ring of plen slots is enough), a min-heap of processes
+ * blocked on I/O or sleeping, and the time the I/O device frees up.
+ */
+struct coro_sim {
+    struct coro* cos;
+    struct pcb* procs;
+    int plen;
+    int* ready;
+    int head;
+    int count;
+    struct coro_block* blocked;
+    int nblocked;
+    int io_free;
+    int io_busy;
+    int finished;
+    int last_finish;
+    long long resumes;
+};
+
+static bool block_before(const struct coro_block* a, const struct coro_block* b) {
+    return (a->until != b->until) ? a->until < b->until : a->pid < b->pid;
+}
+
+static void block_push(struct coro_sim* s, int pid, int until) {
+    struct coro_block node = { until, pid };
+    int i = s->nblocked++;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!block_before(&node, &s->blocked[parent])) {
+            break;
+        }
+        s->blocked[i] = s->blocked[parent];
+        i = parent;
+    }
+    s->blocked[i] = node;
+}
+
+static struct coro_block block_pop(struct coro_sim* s) {
+    struct coro_block top = s->blocked[0];
+    struct coro_block last = s->blocked[--s->nblocked];
+
+    int i = 0;
+    while (1) {
+        int child = 2 * i + 1;
+        if (child >= s->nblocked) {
+            break;
+        }
+        if (child + 1 < s->nblocked && block_before(&s->blocked[child + 1], &s->blocked[child])) {
+            child++;
+        }
+        if (!block_before(&s->blocked[child], &last)) {
+            break;
+        }
+        s->blocked[i] = s->blocked[child];
+        i = child;
+    }
+    if (s->nblocked > 0) {
+        s->blocked[i] = last;
+    }
+    return top;
+}
+
+static void ready_push(struct coro_sim* s, int pid, int now) {
+    s->ready[(s->head + s->count) % s->plen] = pid;
+    s->count++;
+    s->cos[pid].queued = now;
+}
+
+static int ready_pop(struct coro_sim* s) {
+    int pid = s->ready[s->head];
+    s->head = (s->head + 1) % s->plen;
+    s->count--;
+    return pid;
+}
+
+/**
+ * Resume process `pid` at time `now`, its last request served, and
+ * carry out what it yields next. Requests that take no time are served
+ * on the spot.
+ */
+static void coro_step(struct coro_sim* s, int pid, int now) {
+    struct coro* co = &s->cos[pid];
+    for (;;) {
+        co->now = now;
+        co->delay = (co->line == 0) ? 0 : now - co->since - co->amount;
+        co->fn(co);
+        s->resumes++;
+
+        co->since = now;
+        int amount = (co->amount > 0) ? co->amount : 0;
+        if (co->op == CORO_EXIT) {
+            s->finished++;
+            s->last_finish = (now > s->last_finish) ? now : s->last_finish;
+            return;
+        }
+        if (amount == 0) {
+            continue;
+        }
+        if (co->op == CORO_CPU) {
+            co->left = amount;
+            ready_push(s, pid, now);
+        } else if (co->op == CORO_IO) {
+            int start = (s->io_free > now) ? s->io_free : now;
+            s->io_free = start + amount;
+            s->io_busy += amount;
+            block_push(s, pid, s->io_free);
+        } else {
+            block_push(s, pid, now + amount);
+        }
+        return;
+    }
+}
+
+/** Resume every process whose I/O or sleep has ended by `now`, in order. */
+static void coro_wake(struct coro_sim* s, int now) {
+    while (s->nblocked > 0 && s->blocked[0].until <= now) {
+        struct coro_block b = block_pop(s);
+        coro_step(s, b.pid, b.until);
+    }
+}
+
+/**
+ * Make `co` a fresh process running `fn`, with `state` as its user state.
+ */
+void coro_init(struct coro* co, coro_fn fn, void* state) {
+    *co = (struct coro){ 0 };
+    co->fn = fn;
+    co->state = state;
+}
+
+/**
+ * Run plen coroutine processes to completion. Every process starts at
+ * time 0, in pid order. CPU requests queue FIFO for the one CPU and run
+ * for at most `quantum` at a time (0 runs each to completion). I/O
+ * requests queue FIFO for the one device; sleeps overlap freely. As in
+ * io_rr_run, processes woken during a slice join the ready queue before
+ * the preempted process does.
+ *
+ * procs (plen entries) receives one PCB per process with the total time
+ * spent in the ready queue as its wait. stats may be NULL.
+ *
+ * Returns the time the last process exited, or 0 on invalid input.
+ */
+int coro_run(struct coro* cos, int plen, int quantum, struct pcb* procs,
+             struct coro_stats* stats) {
+    if (cos == NULL || plen <= 0 || quantum < 0 || procs == NULL) {
+        return 0;
+    }
+    for (int i = 0; i < plen; i++) {
+        if (cos[i].fn == NULL) {
+            return 0;
+        }
+    }
+
+    struct coro_sim s = { 0 };
+    s.cos = cos;
+    s.procs = procs;
+    s.plen = plen;
+    s.ready = malloc(sizeof(int) * plen);
+    s.blocked = malloc(sizeof(struct coro_block) * plen);
+    if (s.ready == NULL || s.blocked == NULL) {
+        free(s.ready);
+        free(s.blocked);
+        return 0;
+    }
+
+    for (int i = 0; i < plen; i++) {
+        procs[i] = (struct pcb){ i, 0, 0, 0 };
+        cos[i].pid = i;
+        coro_step(&s, i, 0);
+    }
+
+    int now = 0;
+    int busy = 0;
+    while (s.count > 0 || s.nblocked > 0) {
+        if (s.count == 0) {
+            // CPU idle: jump straight to the next wake-up.
+            if (s.blocked[0].until > now) {
+                now = s.blocked[0].until;
+            }
+            coro_wake(&s, now);
+            continue;
+        }
+
+        int pid = ready_pop(&s);
+        struct coro* co = &cos[pid];
+        procs[pid].wait += now - co->queued;
+
+        int run_time = co->left;
+        if (quantum > 0 && quantum < run_time) {
+            run_time = quantum;
+        }
+        now += run_time;
+        busy += run_time;
+        co->left -= run_time;
+
+        coro_wake(&s, now);
+        if (co->left > 0) {
+            ready_push(&s, pid, now);
+        } else {
+            coro_step(&s, pid, now);
+        }
+    }
+
+    if (stats != NULL) {
+        stats->total_time = s.last_finish;
+        stats->busy = busy;
+        stats->io_busy = s.io_busy;
+        stats->completed = s.finished;
+        stats->resumes = s.resumes;
+    }
+
+    free(s.ready);
+    free(s.blocked);
+    return s.last_finish;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "parta.h"
+
+/**
+ * Scripted processes as stackless coroutines. Instead of a fixed list of
+ * bursts, each process is a function that the scheduler core resumes
+ * whenever its last request has been served; it then yields its next
+ * request (run on the CPU, do I/O, sleep, or exit), which may depend on
+ * what happened so far, e.g. how long it had to wait.
+ *
+ * A body is written with CO_BEGIN / CO_YIELD / CO_END, which turn it into
+ * a switch over resume points (a protothread), so a coroutine costs one
+ * struct coro and a resume is an indirect call plus a jump. Locals do not
+ * survive a yield: keep anything that must in *state. Two yields on the
+ * same source line would share a resume point, so keep them on separate
+ * lines.
+ *
+ *     static void handler(struct coro* co) {
+ *         struct handler_state* s = co->state;
+ *         CO_BEGIN(co);
+ *         for (s->i = 0; s->i < s->requests; s->i++) {
+ *             CO_YIELD(co, CORO_CPU, 2);
+ *             CO_YIELD(co, CORO_IO, 5);
+ *         }
+ *         CO_END(co);
+ *     }
+ */
+
+/** What a coroutine asks of the scheduler core when it yields */
+enum coro_op {
+    CORO_CPU,   /** Run for `amount` ticks, preemptible by the quantum */
+    CORO_IO,    /** Use the I/O device (one, served FCFS) for `amount` ticks */
+    CORO_SLEEP, /** Block for `amount` ticks */
+    CORO_EXIT,  /** Terminate */
+};
+
+struct coro;
+
+/** Coroutine body; resumed with co->now and co->delay up to date */
+typedef void (*coro_fn)(struct coro* co);
+
+/** One simulated process */
+struct coro {
+    coro_fn fn;      /** Body */
+    void* state;     /** User state, kept across yields */
+    int pid;         /** Process id, its index in the array */
+    int line;        /** Resume point, managed by CO_BEGIN / CO_YIELD */
+    enum coro_op op; /** Request of the last yield */
+    int amount;      /** Ticks requested by the last yield */
+    int now;         /** Time of the current resume */
+    int delay;       /** How much longer than `amount` the last request took */
+    int left;        /** Scheduler core: CPU time left of the request */
+    int since;       /** Scheduler core: when the request was made */
+    int queued;      /** Scheduler core: when it last joined the ready queue */
+};
+
+/** Whole-run metrics reported by coro_run */
+struct coro_stats {
+    int total_time;     /** Time the last process exited */
+    int busy;           /** Time the CPU spent running processes */
+    int io_busy;        /** Time the I/O device spent serving requests */
+    int completed;      /** Processes that exited */
+    long long resumes;  /** Coroutine resumes */
+};
+
+#define CO_BEGIN(co)                                                                          \
+    switch ((co)->line) {                                                                     \
+    case 0:
+
+#define CO_YIELD(co, request, ticks)                                                          \
+    do {                                                                                      \
+        (co)->line = __LINE__;                                                                \
+        (co)->op = (request);                                                                 \
+        (co)->amount = (ticks);                                                               \
+        return;                                                                               \
+    case __LINE__:;                                                                           \
+    } while (0)
+
+#define CO_END(co)                                                                            \
+    }                                                                                         \
+    (co)->line = -1;                                                                          \
+    (co)->op = CORO_EXIT;                                                                     \
+    (co)->amount = 0
+
+
+void coro_init(struct coro* co, coro_fn fn, void* state);
+int coro_run(struct coro* cos, int plen, int quantum, struct pcb* procs,
+             struct coro_stats* stats);
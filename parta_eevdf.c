@@ -0,0 +1,230 @@
+#include "parta_eevdf.h"
+#include <stdlib.h>
+
+/**
+ * A task's treap node, ordered by (vruntime, idx). best and best_deadline
+ * are the earliest (deadline, idx) in the subtree, kept in the node so
+ * the pick never has to visit the task they refer to.
+ */
+struct eevdf_node {
+    long long vruntime;
+    long long deadline;
+    long long best_deadline;
+    int best;
+    int left;  /* -1 when empty */
+    int right;
+    unsigned heap; /* Treap priority, a hash of the index */
+};
+
+static unsigned hash_idx(int idx) {
+    unsigned x = (unsigned)idx * 0x9E3779B9u;
+    x ^= x >> 16;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    return x;
+}
+
+static bool key_before(const struct eevdf_node* t, int a, int b) {
+    return (t[a].vruntime != t[b].vruntime) ? t[a].vruntime < t[b].vruntime : a < b;
+}
+
+/** Whether subtree n's earliest deadline comes before (deadline, idx). */
+static bool best_before(const struct eevdf_node* t, int n, long long deadline, int idx) {
+    return (t[n].best_deadline != deadline) ? t[n].best_deadline < deadline : t[n].best < idx;
+}
+
+static void take_best(struct eevdf_node* t, int n, int child) {
+    if (child >= 0 && best_before(t, child, t[n].best_deadline, t[n].best)) {
+        t[n].best = t[child].best;
+        t[n].best_deadline = t[child].best_deadline;
+    }
+}
+
+static void pull(struct eevdf_node* t, int n) {
+    t[n].best = n;
+    t[n].best_deadline = t[n].deadline;
+    take_best(t, n, t[n].left);
+    take_best(t, n, t[n].right);
+}
+
+/** Split the tree at n into the nodes ordered before k and the rest. */
+static void split(struct eevdf_node* t, int n, int k, int* before, int* after) {
+    if (n < 0) {
+        *before = -1;
+        *after = -1;
+        return;
+    }
+    if (key_before(t, n, k)) {
+        split(t, t[n].right, k, &t[n].right, after);
+        *before = n;
+    } else {
+        split(t, t[n].left, k, before, &t[n].left);
+        *after = n;
+    }
+    pull(t, n);
+}
+
+/** Join two trees where every node of a is ordered before b's. */
+static int merge(struct eevdf_node* t, int a, int b) {
+    if (a < 0 || b < 0) {
+        return (a < 0) ? b : a;
+    }
+    if (t[a].heap > t[b].heap) {
+        t[a].right = merge(t, t[a].right, b);
+        pull(t, a);
+        return a;
+    }
+    t[b].left = merge(t, a, t[b].left);
+    pull(t, b);
+    return b;
+}
+
+static int insert(struct eevdf_node* t, int root, int k) {
+    int before, after;
+    split(t, root, k, &before, &after);
+    t[k].left = -1;
+    t[k].right = -1;
+    pull(t, k);
+    return merge(t, merge(t, before, k), after);
+}
+
+/** Remove k, which must be in the tree with its current key. */
+static int erase(struct eevdf_node* t, int n, int k) {
+    if (n == k) {
+        return merge(t, t[n].left, t[n].right);
+    }
+    if (key_before(t, k, n)) {
+        t[n].left = erase(t, t[n].left, k);
+    } else {
+        t[n].right = erase(t, t[n].right, k);
+    }
+    pull(t, n);
+    return n;
+}
+
+/**
+ * Find the eligible task with the earliest deadline. A task is eligible
+ * when v_i <= V = sum / load, compared as v_i * load <= sum to stay exact.
+ * When a node is eligible, so is its whole left subtree; otherwise its
+ * whole right subtree is not. Since the smallest v_i is at most V, some
+ * task always qualifies.
+ */
+static int pick(const struct eevdf_node* t, int n, long long load, __int128 sum) {
+    int best = -1;
+    long long deadline = 0;
+    while (n >= 0) {
+        if ((__int128)t[n].vruntime * load <= sum) {
+            int l = t[n].left;
+            if (l >= 0 && (best < 0 || best_before(t, l, deadline, best))) {
+                best = t[l].best;
+                deadline = t[l].best_deadline;
+            }
+            if (best < 0 || t[n].deadline < deadline ||
+                (t[n].deadline == deadline && n < best)) {
+                best = n;
+                deadline = t[n].deadline;
+            }
+            n = t[n].right;
+        } else {
+            n = t[n].left;
+        }
+    }
+    return best;
+}
+
+/**
+ * Weight of a PCB priority for eevdf_run: PRIO_LEVELS - priority, so the
+ * highest priority (0) weighs PRIO_LEVELS and the lowest weighs 1.
+ */
+int eevdf_prio_weight(int priority) {
+    if (priority < 0) {
+        priority = 0;
+    }
+    if (priority >= PRIO_LEVELS) {
+        priority = PRIO_LEVELS - 1;
+    }
+    return PRIO_LEVELS - priority;
+}
+
+/**
+ * Run all processes using EEVDF with the given slice. Every process
+ * arrives at time 0 with virtual runtime 0. weights may be NULL, in which
+ * case each weight is eevdf_prio_weight of the PCB's priority; otherwise
+ * each must be in 1..EEVDF_SCALE.
+ *
+ * With equal weights every task is eligible again only once all the
+ * others have caught up, so this is Round-Robin with quantum = slice.
+ *
+ * latency, if not NULL, receives the time each process first ran (0 for
+ * processes with no burst).
+ *
+ * Returns the total time elapsed when all processes are complete, or 0
+ * on invalid input.
+ */
+int eevdf_run(struct pcb* procs, int plen, const int* weights, int slice, int* latency) {
+    if (procs == NULL || plen <= 0 || slice <= 0) {
+        return 0;
+    }
+    for (int i = 0; weights != NULL && i < plen; i++) {
+        if (weights[i] <= 0 || weights[i] > EEVDF_SCALE) {
+            return 0;
+        }
+    }
+
+    struct eevdf_node* t = malloc(sizeof(struct eevdf_node) * plen);
+    int* weight = malloc(sizeof(int) * plen);
+    int* burst = malloc(sizeof(int) * plen);
+    bool ok = t != NULL && weight != NULL && burst != NULL;
+
+    int root = -1;
+    long long load = 0; // Summed weight of runnable tasks
+    __int128 sum = 0;   // Summed weight * vruntime of runnable tasks
+    for (int i = 0; ok && i < plen; i++) {
+        weight[i] = (weights != NULL) ? weights[i] : eevdf_prio_weight(procs[i].priority);
+        burst[i] = procs[i].burst_left;
+        if (latency != NULL) {
+            latency[i] = 0;
+        }
+        if (burst[i] > 0) {
+            t[i].heap = hash_idx(i);
+            t[i].vruntime = 0;
+            t[i].deadline = (long long)(EEVDF_SCALE / weight[i]) * slice;
+            root = insert(t, root, i);
+            load += weight[i];
+        }
+    }
+
+    int total_time = 0;
+    while (ok && root >= 0) {
+        int current = pick(t, root, load, sum);
+        if (latency != NULL && procs[current].burst_left == burst[current]) {
+            latency[current] = total_time;
+        }
+
+        int run_time = procs[current].burst_left;
+        if (slice < run_time) {
+            run_time = slice;
+        }
+        total_time += run_time;
+        procs[current].burst_left -= run_time;
+
+        // Reposition the task under its new virtual runtime and deadline.
+        root = erase(t, root, current);
+        long long stride = EEVDF_SCALE / weight[current];
+        t[current].vruntime += stride * run_time;
+        sum += (__int128)weight[current] * stride * run_time;
+        if (procs[current].burst_left > 0) {
+            t[current].deadline = t[current].vruntime + stride * slice;
+            root = insert(t, root, current);
+        } else {
+            procs[current].wait += total_time - burst[current];
+            load -= weight[current];
+            sum -= (__int128)weight[current] * t[current].vruntime;
+        }
+    }
+
+    free(t);
+    free(weight);
+    free(burst);
+    return ok ? total_time : 0;
+}
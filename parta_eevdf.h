@@ -0,0 +1,25 @@
+#pragma once
+
+#include "parta.h"
+
+/**
+ * EEVDF (Earliest Eligible Virtual Deadline First), the scheduler Linux
+ * uses in place of CFS. Each task i has a weight w_i and a virtual
+ * runtime v_i that advances by EEVDF_SCALE / w_i per tick it runs. The
+ * virtual time V is the weighted mean of v_i over runnable tasks, and a
+ * task's lag is w_i * (V - v_i): the service it is owed. A task is
+ * eligible when its lag is not negative, and its virtual deadline is
+ * v_i + slice * EEVDF_SCALE / w_i. The eligible task with the earliest
+ * deadline runs for one slice (or what is left of its burst).
+ *
+ * Tasks sit in a treap ordered by virtual runtime, where each node also
+ * records the earliest deadline in its subtree. Eligible tasks form a
+ * prefix of that order, so the pick is one descent, O(log n) expected.
+ */
+
+/** Virtual runtime of one tick at weight 1, and the largest weight */
+#define EEVDF_SCALE (1 << 20)
+
+
+int eevdf_prio_weight(int priority);
+int eevdf_run(struct pcb* procs, int plen, const int* weights, int slice, int* latency);
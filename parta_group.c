@@ -0,0 +1,339 @@
+#include "parta_group.h"
+#include "parta_share.h"
+#include <stdlib.h>
+#include <string.h>
+
+/** Groups in id order; a parent always has a smaller id than its children */
+struct group_tree {
+    int count;
+    int cap;
+    char** paths;
+    int* weights;
+    int* parents;
+};
+
+static bool group_grow(struct group_tree* t) {
+    int cap = (t->cap > 0) ? 2 * t->cap : 8;
+    char** paths = realloc(t->paths, sizeof(char*) * cap);
+    if (paths != NULL) {
+        t->paths = paths;
+    }
+    int* weights = realloc(t->weights, sizeof(int) * cap);
+    if (weights != NULL) {
+        t->weights = weights;
+    }
+    int* parents = realloc(t->parents, sizeof(int) * cap);
+    if (parents != NULL) {
+        t->parents = parents;
+    }
+    if (paths == NULL || weights == NULL || parents == NULL) {
+        return false;
+    }
+    t->cap = cap;
+    return true;
+}
+
+/** Append the group at the first `len` bytes of `path`. Returns its id or -1. */
+static int group_append(struct group_tree* t, const char* path, size_t len, int weight,
+                        int parent) {
+    if (t->count == t->cap && !group_grow(t)) {
+        return -1;
+    }
+    char* copy = malloc(len + 1);
+    if (copy == NULL) {
+        return -1;
+    }
+    memcpy(copy, path, len);
+    copy[len] = '\0';
+
+    int id = t->count++;
+    t->paths[id] = copy;
+    t->weights[id] = weight;
+    t->parents[id] = parent;
+    return id;
+}
+
+static int group_find_n(const struct group_tree* t, const char* path, size_t len) {
+    for (int g = 0; g < t->count; g++) {
+        if (strncmp(t->paths[g], path, len) == 0 && t->paths[g][len] == '\0') {
+            return g;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Create a tree holding only the root group (id 0, path "").
+ *
+ * Returns the tree, or NULL if memory runs out.
+ */
+struct group_tree* group_create(void) {
+    struct group_tree* t = calloc(1, sizeof(struct group_tree));
+    if (t == NULL) {
+        return NULL;
+    }
+    if (group_append(t, "", 0, 1, -1) < 0) {
+        group_free(t);
+        return NULL;
+    }
+    return t;
+}
+
+void group_free(struct group_tree* t) {
+    if (t == NULL) {
+        return;
+    }
+    for (int g = 0; g < t->count; g++) {
+        free(t->paths[g]);
+    }
+    free(t->paths);
+    free(t->weights);
+    free(t->parents);
+    free(t);
+}
+
+/**
+ * Give the group at `path` (components separated by '/', e.g. "web/api")
+ * the weight 1 <= weight <= STRIDE1, creating it if needed. Missing
+ * ancestors are created with weight 1. The root ("") has no siblings, so
+ * its weight is accepted but has no effect.
+ *
+ * Returns the group id, or -1 if the path or weight is invalid.
+ */
+int group_add(struct group_tree* t, const char* path, int weight) {
+    if (t == NULL || path == NULL || weight <= 0 || weight > STRIDE1) {
+        return -1;
+    }
+    size_t len = strlen(path);
+    if (len >= GROUP_MAX_PATH) {
+        return -1;
+    }
+
+    // Check the whole path first, so a bad one creates no ancestors.
+    int depth = 0;
+    for (size_t end = 0, begin = 0; len > 0 && end <= len; end++) {
+        if (end == len || path[end] == '/') {
+            if (end == begin || ++depth > GROUP_MAX_DEPTH) {
+                return -1; // Empty component or too deep
+            }
+            begin = end + 1;
+        }
+    }
+
+    int parent = 0;
+    for (size_t end = 0; len > 0 && end <= len; end++) {
+        if (end < len && path[end] != '/') {
+            continue;
+        }
+        int g = group_find_n(t, path, end);
+        if (g < 0) {
+            g = group_append(t, path, end, 1, parent);
+            if (g < 0) {
+                return -1;
+            }
+        }
+        parent = g;
+    }
+    t->weights[parent] = weight;
+    return parent;
+}
+
+/** Returns the id of the group at `path`, or -1 if there is none. */
+int group_find(const struct group_tree* t, const char* path) {
+    if (t == NULL || path == NULL) {
+        return -1;
+    }
+    return group_find_n(t, path, strlen(path));
+}
+
+int group_count(const struct group_tree* t) {
+    return (t != NULL) ? t->count : 0;
+}
+
+const char* group_path(const struct group_tree* t, int id) {
+    return (t != NULL && id >= 0 && id < t->count) ? t->paths[id] : NULL;
+}
+
+int group_weight(const struct group_tree* t, int id) {
+    return (t != NULL && id >= 0 && id < t->count) ? t->weights[id] : 0;
+}
+
+/** Runqueue entry ordered by (pass, idx): a process idx < plen, or group idx - plen */
+struct group_node {
+    long long pass;
+    int idx;
+};
+
+static bool group_before(const struct group_node* a, const struct group_node* b) {
+    return (a->pass != b->pass) ? a->pass < b->pass : a->idx < b->idx;
+}
+
+static void group_sift_down(struct group_node* h, int len, int i) {
+    struct group_node node = h[i];
+    while (1) {
+        int child = 2 * i + 1;
+        if (child >= len) {
+            break;
+        }
+        if (child + 1 < len && group_before(&h[child + 1], &h[child])) {
+            child++;
+        }
+        if (!group_before(&h[child], &node)) {
+            break;
+        }
+        h[i] = h[child];
+        i = child;
+    }
+    h[i] = node;
+}
+
+/**
+ * Run all processes under hierarchical stride scheduling. Process i
+ * belongs to group groups[i] (groups may be NULL: all in the root).
+ *
+ * Each group with runnable work keeps a heap of its runnable children,
+ * all in one array laid out group after group. Following the heap tops
+ * from the root leads to the process that runs next, for
+ * min(quantum, burst_left); its pass then advances by STRIDE1 per unit of
+ * time, and so does every group on its path by STRIDE1 / weight. A child
+ * that runs out of work leaves its parent's heap. Since everything
+ * arrives at time 0, a group never becomes runnable again.
+ *
+ * stats, if not NULL, receives group_count(t) entries; each covers the
+ * group and its subgroups.
+ *
+ * Returns the total time elapsed when all processes are complete, or 0
+ * on invalid input.
+ */
+int group_run(const struct group_tree* t, struct pcb* procs, int plen, const int* groups,
+              int quantum, struct group_stats* stats) {
+    if (t == NULL || procs == NULL || plen <= 0 || quantum <= 0) {
+        return 0;
+    }
+    for (int i = 0; groups != NULL && i < plen; i++) {
+        if (groups[i] < 0 || groups[i] >= t->count) {
+            return 0;
+        }
+    }
+
+    int ng = t->count;
+    int* start = calloc(ng, sizeof(int));
+    int* len = calloc(ng, sizeof(int));
+    int* count = calloc(ng, sizeof(int));
+    long long* finish = calloc(ng, sizeof(long long));
+    int* burst = malloc(sizeof(int) * plen);
+    struct group_node* heap = malloc(sizeof(struct group_node) * ((size_t)plen + ng));
+    if (start == NULL || len == NULL || count == NULL || finish == NULL || burst == NULL ||
+        heap == NULL) {
+        free(start);
+        free(len);
+        free(count);
+        free(finish);
+        free(burst);
+        free(heap);
+        return 0;
+    }
+
+    // Count runnable children. Children have larger ids than their
+    // parent, so a reverse sweep sees a group's count before its parent.
+    for (int i = 0; i < plen; i++) {
+        burst[i] = procs[i].burst_left;
+        if (burst[i] > 0) {
+            count[(groups != NULL) ? groups[i] : 0]++;
+        }
+    }
+    for (int g = ng - 1; g > 0; g--) {
+        if (count[g] > 0) {
+            count[t->parents[g]]++;
+        }
+    }
+    for (int g = 1; g < ng; g++) {
+        start[g] = start[g - 1] + count[g - 1];
+    }
+
+    // Every pass starts at 0 and children go in idx order, so each
+    // runqueue is a heap.
+    for (int i = 0; i < plen; i++) {
+        if (burst[i] > 0) {
+            int g = (groups != NULL) ? groups[i] : 0;
+            heap[start[g] + len[g]++] = (struct group_node){ 0, i };
+        }
+    }
+    for (int g = 1; g < ng; g++) {
+        if (count[g] > 0) {
+            int p = t->parents[g];
+            heap[start[p] + len[p]++] = (struct group_node){ 0, plen + g };
+        }
+    }
+
+    int total_time = 0;
+    while (len[0] > 0) {
+        int g = 0;
+        int current = heap[0].idx;
+        while (current >= plen) {
+            g = current - plen;
+            current = heap[start[g]].idx;
+        }
+
+        int run_time = procs[current].burst_left;
+        if (quantum < run_time) {
+            run_time = quantum;
+        }
+        total_time += run_time;
+        procs[current].burst_left -= run_time;
+
+        // The entity that ran is the top of each runqueue on the way up.
+        struct group_node* h = &heap[start[g]];
+        if (procs[current].burst_left == 0) {
+            procs[current].wait += total_time - burst[current];
+            finish[g] = total_time;
+            h[0] = h[--len[g]];
+        } else {
+            h[0].pass += (long long)STRIDE1 * run_time;
+        }
+        if (len[g] > 0) {
+            group_sift_down(h, len[g], 0);
+        }
+        for (; g > 0; g = t->parents[g]) {
+            int p = t->parents[g];
+            h = &heap[start[p]];
+            if (len[g] == 0) {
+                h[0] = h[--len[p]];
+            } else {
+                h[0].pass += (long long)(STRIDE1 / t->weights[g]) * run_time;
+            }
+            if (len[p] > 0) {
+                group_sift_down(h, len[p], 0);
+            }
+        }
+    }
+
+    for (int g = 0; stats != NULL && g < ng; g++) {
+        stats[g] = (struct group_stats){ 0, finish[g], 0.0, 0, 0 };
+    }
+    for (int i = 0; stats != NULL && i < plen; i++) {
+        struct group_stats* s = &stats[(groups != NULL) ? groups[i] : 0];
+        s->cpu += burst[i];
+        s->wait += procs[i].wait;
+        s->procs++;
+    }
+    for (int g = ng - 1; stats != NULL && g >= 0; g--) {
+        struct group_stats* s = &stats[g];
+        s->share = (s->finish > 0) ? (double)s->cpu / s->finish : 0.0;
+        if (g > 0) {
+            struct group_stats* p = &stats[t->parents[g]];
+            p->cpu += s->cpu;
+            p->wait += s->wait;
+            p->procs += s->procs;
+            p->finish = (s->finish > p->finish) ? s->finish : p->finish;
+        }
+    }
+
+    free(start);
+    free(len);
+    free(count);
+    free(finish);
+    free(burst);
+    free(heap);
+    return total_time;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "parta.h"
+
+/**
+ * Hierarchical proportional-share scheduling, in the style of cgroup CPU
+ * weights. Groups form a tree under a root group (path ""); a group is
+ * named by its path, e.g. "web/api". Processes are leaves of the group
+ * they belong to, each with weight 1 among its siblings.
+ *
+ * Every group runs stride scheduling (see stride_run) over its runnable
+ * children, processes and subgroups alike, with a binary heap on pass
+ * values. The next process is found by taking the heap top from the
+ * root down, and the slice it runs is charged to every entity on that
+ * path, so each decision is O(depth * log fanout).
+ */
+
+/** Deepest group path below the root */
+#define GROUP_MAX_DEPTH 16
+
+/** Longest group path, in bytes */
+#define GROUP_MAX_PATH 256
+
+struct group_tree;
+
+/** Outcome of group_run for one group, its subgroups included */
+struct group_stats {
+    long long cpu;    /** Time its processes ran */
+    long long finish; /** When its last process completed */
+    double share;     /** cpu / finish: its CPU share while it had work */
+    long long wait;   /** Summed wait of its processes */
+    int procs;        /** Processes in it */
+};
+
+
+struct group_tree* group_create(void);
+void group_free(struct group_tree* t);
+int group_add(struct group_tree* t, const char* path, int weight);
+int group_find(const struct group_tree* t, const char* path);
+int group_count(const struct group_tree* t);
+const char* group_path(const struct group_tree* t, int id);
+int group_weight(const struct group_tree* t, int id);
+
+int group_run(const struct group_tree* t, struct pcb* procs, int plen, const int* groups,
+              int quantum, struct group_stats* stats);
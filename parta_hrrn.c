@@ -0,0 +1,216 @@
+#include "parta_hrrn.h"
+#include <limits.h>
+#include <stdlib.h>
+
+/** Certificate of a node whose winner cannot be overtaken */
+#define NEVER LLONG_MAX
+
+/**
+ * Kinetic tournament over `size` leaves (a power of two), stored as an
+ * implicit binary tree: node 1 is the root, leaf p is node size + p.
+ */
+struct kinetic {
+    int size;
+    int* win;          /* Winner of the node's subtree, -1 if none arrived */
+    long long* fail;   /* When the node's loser overtakes its winner */
+    long long* next;   /* Earliest fail in the node's subtree */
+    const int* burst;
+    const int* arrival;
+    long long events;  /* Certificate failures processed */
+};
+
+/**
+ * Whether process i has a higher response ratio than j at time t, ties
+ * going to the lower pid. Compares (t - a_i + b_i) / b_i with
+ * (t - a_j + b_j) / b_j by cross-multiplying.
+ */
+static bool beats(const struct kinetic* k, int i, int j, long long t) {
+    __int128 ri = (__int128)(t - k->arrival[i] + k->burst[i]) * k->burst[j];
+    __int128 rj = (__int128)(t - k->arrival[j] + k->burst[j]) * k->burst[i];
+    return (ri != rj) ? ri > rj : i < j;
+}
+
+/**
+ * First time at which l beats w, given that w wins now. Only a process
+ * with a shorter burst has a steeper ratio and can catch up: l beats w
+ * once t * (b_w - b_l) > c_w * b_l - c_l * b_w, with c = b - a, or at
+ * equality when l has the lower pid.
+ */
+static long long certificate(const struct kinetic* k, int w, int l) {
+    __int128 bw = k->burst[w];
+    __int128 bl = k->burst[l];
+    if (bl >= bw) {
+        return NEVER;
+    }
+    __int128 n = (bw - k->arrival[w]) * bl - (bl - k->arrival[l]) * bw;
+    __int128 d = bw - bl;
+    __int128 q = n / d;
+    if (n % d != 0 && n < 0) {
+        q--; // Round toward -inf
+    }
+    if (!(l < w && q * d == n)) {
+        q++;
+    }
+    return (q >= NEVER) ? NEVER : (long long)q;
+}
+
+static void recompute(struct kinetic* k, int node, long long t) {
+    int i = k->win[2 * node];
+    int j = k->win[2 * node + 1];
+    if (i < 0 || j < 0) {
+        k->win[node] = (i < 0) ? j : i;
+        k->fail[node] = NEVER;
+    } else if (beats(k, i, j, t)) {
+        k->win[node] = i;
+        k->fail[node] = certificate(k, i, j);
+    } else {
+        k->win[node] = j;
+        k->fail[node] = certificate(k, j, i);
+    }
+
+    long long next = k->fail[node];
+    if (k->next[2 * node] < next) {
+        next = k->next[2 * node];
+    }
+    if (k->next[2 * node + 1] < next) {
+        next = k->next[2 * node + 1];
+    }
+    k->next[node] = next;
+}
+
+/** Add (active) or remove process p at time t, which must be current. */
+static void set_leaf(struct kinetic* k, int p, bool active, long long t) {
+    int node = k->size + p;
+    k->win[node] = active ? p : -1;
+    for (node /= 2; node >= 1; node /= 2) {
+        recompute(k, node, t);
+    }
+}
+
+/**
+ * Bring every node up to time t. Each failed certificate is replayed at
+ * t itself rather than at its failure time: several crossings below t
+ * collapse into one, and the new certificate is always later than t.
+ */
+static void advance(struct kinetic* k, long long t) {
+    while (k->next[1] <= t) {
+        int node = 1;
+        while (k->fail[node] != k->next[1]) {
+            node = (k->next[2 * node] == k->next[1]) ? 2 * node : 2 * node + 1;
+        }
+        for (; node >= 1; node /= 2) {
+            recompute(k, node, t);
+        }
+        k->events++;
+    }
+}
+
+/** Sort key for the arrival order, (arrival, pid) */
+struct hrrn_key {
+    int arrival;
+    int idx;
+};
+
+static int hrrn_cmp(const void* a, const void* b) {
+    const struct hrrn_key* x = a;
+    const struct hrrn_key* y = b;
+    if (x->arrival != y->arrival) {
+        return (x->arrival < y->arrival) ? -1 : 1;
+    }
+    return (x->idx > y->idx) - (x->idx < y->idx);
+}
+
+/**
+ * Run all processes using non-preemptive HRRN, ties going to the lower
+ * pid. Process i arrives at arrival[i] >= 0. arrival may be NULL: all
+ * arrive at time 0, where every ratio is 1, so P0 runs first and SJF
+ * order follows. A process waits from its arrival until it starts;
+ * processes with no burst do not run. The CPU idles when no process has
+ * arrived.
+ *
+ * events, if not NULL, receives the number of certificate failures.
+ *
+ * Returns the time the last process completed, or 0 on invalid input.
+ */
+int hrrn_run(struct pcb* procs, int plen, const int* arrival, long long* events) {
+    if (procs == NULL || plen <= 0) {
+        return 0;
+    }
+    for (int i = 0; arrival != NULL && i < plen; i++) {
+        if (arrival[i] < 0) {
+            return 0;
+        }
+    }
+
+    struct kinetic k;
+    k.size = 1;
+    while (k.size < plen) {
+        k.size *= 2;
+    }
+    k.win = malloc(sizeof(int) * 2 * k.size);
+    k.fail = malloc(sizeof(long long) * 2 * k.size);
+    k.next = malloc(sizeof(long long) * 2 * k.size);
+    int* burst = malloc(sizeof(int) * plen);
+    int* arrived = (arrival != NULL) ? NULL : calloc(plen, sizeof(int));
+    struct hrrn_key* order = malloc(sizeof(struct hrrn_key) * plen);
+    if (k.win == NULL || k.fail == NULL || k.next == NULL || burst == NULL || order == NULL ||
+        (arrival == NULL && arrived == NULL)) {
+        free(k.win);
+        free(k.fail);
+        free(k.next);
+        free(burst);
+        free(arrived);
+        free(order);
+        return 0;
+    }
+    k.burst = burst;
+    k.arrival = (arrival != NULL) ? arrival : arrived;
+    k.events = 0;
+    for (int node = 0; node < 2 * k.size; node++) {
+        k.win[node] = -1;
+        k.fail[node] = NEVER;
+        k.next[node] = NEVER;
+    }
+
+    int remaining = 0;
+    for (int i = 0; i < plen; i++) {
+        burst[i] = procs[i].burst_left;
+        remaining += (burst[i] > 0);
+        order[i].arrival = k.arrival[i];
+        order[i].idx = i;
+    }
+    qsort(order, plen, sizeof(struct hrrn_key), hrrn_cmp);
+
+    long long t = 0;
+    int pending = 0; // Next entry of order to arrive
+    while (remaining > 0) {
+        advance(&k, t);
+        for (; pending < plen && order[pending].arrival <= t; pending++) {
+            if (burst[order[pending].idx] > 0) {
+                set_leaf(&k, order[pending].idx, true, t);
+            }
+        }
+        if (k.win[1] < 0) {
+            t = order[pending].arrival; // Idle until the next arrival
+            continue;
+        }
+
+        int current = k.win[1];
+        set_leaf(&k, current, false, t);
+        procs[current].wait += (int)(t - k.arrival[current]);
+        procs[current].burst_left = 0;
+        t += burst[current];
+        remaining--;
+    }
+
+    if (events != NULL) {
+        *events = k.events;
+    }
+    free(k.win);
+    free(k.fail);
+    free(k.next);
+    free(burst);
+    free(arrived);
+    free(order);
+    return (int)t;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "parta.h"
+
+/**
+ * Highest-Response-Ratio-Next: whenever the CPU is free, run the arrived
+ * process with the highest (wait + burst) / burst to completion. For a
+ * process with burst b that arrived at a, the ratio at time t is
+ * 1 + (t - a) / b, a line in t, so the order of two processes changes at
+ * most once.
+ *
+ * A kinetic tournament keeps the winner: a segment tree over pids where
+ * each node holds the winner of its two children at the current time,
+ * together with a certificate, the first time the loser overtakes it.
+ * Advancing the clock only revisits nodes whose certificate has failed
+ * (the earliest failure of each subtree is kept in the nodes), instead of
+ * comparing every process at every decision.
+ */
+
+int hrrn_run(struct pcb* procs, int plen, const int* arrival, long long* events);
@@ -0,0 +1,450 @@
+#include "parta_inc.h"
+#include <stdlib.h>
+#include <string.h>
+
+/** Treap node of process pid lives at nodes[pid] */
+struct inc_node {
+    int left;
+    int right;
+    unsigned int prio;
+};
+
+struct rr_inc {
+    int quantum;
+    int plen;
+    int cap;
+    int* burst;       /* Burst of each pid, <= 0 when absent */
+    long long* wait;  /* Current wait of each pid (0 when absent) */
+    struct inc_node* nodes;
+    int root;         /* Treap of present pids keyed by (burst, pid), -1 if empty */
+    int present;      /* Pids with a positive burst */
+    long long total;  /* Sum of positive bursts */
+    long long sum_wait;
+    int* changed;     /* Pids whose wait changed in the last update */
+    int nchanged;
+    unsigned long long rng;
+};
+
+static long long rounds(long long b, long long q) {
+    return (b > 0) ? (b + q - 1) / q : 0;
+}
+
+static long long min_ll(long long a, long long b) {
+    return (a < b) ? a : b;
+}
+
+static int cmp_int(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+/** Index of the first element of sorted[0..n) greater than `value`. */
+static int upper_bound(const int* sorted, int n, long long value) {
+    int lo = 0;
+    int hi = n;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (sorted[mid] <= value) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * Run all processes using Round-Robin, like rr_run, but from the closed
+ * form in parta_inc.h instead of simulating slices. The first term,
+ * sum of min(b_j, q * (c_i - 1)), comes from the sorted bursts and their
+ * prefix sums. The correction for earlier processes, q for each with
+ * more rounds plus the last slice of each with as many, comes from a
+ * sweep in pid order with a Fenwick tree over round counts.
+ *
+ * O(plen log plen), independent of the total number of slices.
+ *
+ * Returns the total time elapsed when all processes are complete.
+ */
+int rr_analytic_run(struct pcb* procs, int plen, int quantum) {
+    if (procs == NULL || plen <= 0 || quantum <= 0) {
+        return 0;
+    }
+
+    long long q = quantum;
+    int m = 0;
+    int* sorted = malloc(sizeof(int) * plen);
+    long long* prefix = malloc(sizeof(long long) * (plen + 1));
+    int* levels = malloc(sizeof(int) * plen);
+    int* fenwick = calloc(plen + 1, sizeof(int));
+    long long* last = calloc(plen, sizeof(long long));
+    if (sorted == NULL || prefix == NULL || levels == NULL || fenwick == NULL || last == NULL) {
+        free(sorted);
+        free(prefix);
+        free(levels);
+        free(fenwick);
+        free(last);
+        return 0;
+    }
+
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            sorted[m++] = procs[i].burst_left;
+        }
+    }
+    qsort(sorted, m, sizeof(int), cmp_int);
+    prefix[0] = 0;
+    for (int k = 0; k < m; k++) {
+        prefix[k + 1] = prefix[k] + sorted[k];
+    }
+
+    // Round counts are monotone in the burst, so the distinct levels
+    // come out of the sorted bursts in order.
+    int nlevels = 0;
+    for (int k = 0; k < m; k++) {
+        int c = (int)rounds(sorted[k], q);
+        if (nlevels == 0 || levels[nlevels - 1] != c) {
+            levels[nlevels++] = c;
+        }
+    }
+
+    int seen = 0;
+    for (int i = 0; i < plen; i++) {
+        long long b = procs[i].burst_left;
+        if (b <= 0) {
+            continue;
+        }
+        long long c = rounds(b, q);
+        long long cap = q * (c - 1);
+
+        // Everyone else gets up to c - 1 quanta (i itself gets exactly cap).
+        int idx = upper_bound(sorted, m, cap);
+        long long wait = prefix[idx] + cap * (m - idx) - cap;
+
+        // Earlier processes also get round c: q if they need more rounds,
+        // their last slice if they need exactly c.
+        int lvl = upper_bound(levels, nlevels, c) - 1;
+        int not_above = 0;
+        for (int k = lvl + 1; k > 0; k -= k & -k) {
+            not_above += fenwick[k];
+        }
+        wait += q * (seen - not_above) + last[lvl];
+
+        for (int k = lvl + 1; k <= nlevels; k += k & -k) {
+            fenwick[k]++;
+        }
+        last[lvl] += b - cap;
+        seen++;
+
+        procs[i].wait += (int)wait;
+        procs[i].burst_left = 0;
+    }
+
+    long long total = prefix[m];
+    free(sorted);
+    free(prefix);
+    free(levels);
+    free(fenwick);
+    free(last);
+    return (int)total;
+}
+
+static bool key_less(const struct rr_inc* e, int a, int b) {
+    return (e->burst[a] != e->burst[b]) ? e->burst[a] < e->burst[b] : a < b;
+}
+
+/** Split t into keys before pid (*l) and the rest (*r). */
+static void treap_split(struct rr_inc* e, int t, int pid, int* l, int* r) {
+    if (t < 0) {
+        *l = -1;
+        *r = -1;
+    } else if (key_less(e, t, pid)) {
+        treap_split(e, e->nodes[t].right, pid, &e->nodes[t].right, r);
+        *l = t;
+    } else {
+        treap_split(e, e->nodes[t].left, pid, l, &e->nodes[t].left);
+        *r = t;
+    }
+}
+
+static int treap_merge(struct rr_inc* e, int l, int r) {
+    if (l < 0) {
+        return r;
+    }
+    if (r < 0) {
+        return l;
+    }
+    if (e->nodes[l].prio > e->nodes[r].prio) {
+        e->nodes[l].right = treap_merge(e, e->nodes[l].right, r);
+        return l;
+    }
+    e->nodes[r].left = treap_merge(e, l, e->nodes[r].left);
+    return r;
+}
+
+static unsigned int next_prio(struct rr_inc* e) {
+    unsigned long long z = (e->rng += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return (unsigned int)(z ^ (z >> 31));
+}
+
+static void treap_insert(struct rr_inc* e, int pid) {
+    e->nodes[pid].left = -1;
+    e->nodes[pid].right = -1;
+    e->nodes[pid].prio = next_prio(e);
+    int l, r;
+    treap_split(e, e->root, pid, &l, &r);
+    e->root = treap_merge(e, treap_merge(e, l, pid), r);
+}
+
+static int treap_erase(struct rr_inc* e, int t, int pid) {
+    if (t == pid) {
+        return treap_merge(e, e->nodes[t].left, e->nodes[t].right);
+    }
+    if (key_less(e, pid, t)) {
+        e->nodes[t].left = treap_erase(e, e->nodes[t].left, pid);
+    } else {
+        e->nodes[t].right = treap_erase(e, e->nodes[t].right, pid);
+    }
+    return t;
+}
+
+static bool inc_grow(struct rr_inc* e, int cap) {
+    int* burst = realloc(e->burst, sizeof(int) * cap);
+    if (burst == NULL) {
+        return false;
+    }
+    e->burst = burst;
+    long long* wait = realloc(e->wait, sizeof(long long) * cap);
+    if (wait == NULL) {
+        return false;
+    }
+    e->wait = wait;
+    struct inc_node* nodes = realloc(e->nodes, sizeof(struct inc_node) * cap);
+    if (nodes == NULL) {
+        return false;
+    }
+    e->nodes = nodes;
+    int* changed = realloc(e->changed, sizeof(int) * cap);
+    if (changed == NULL) {
+        return false;
+    }
+    e->changed = changed;
+    e->cap = cap;
+    return true;
+}
+
+/**
+ * Create an engine for bursts[0..plen) under Round-Robin with `quantum`,
+ * computing every wait with rr_analytic_run. Bursts <= 0 are processes
+ * that are not present (they never run and wait 0).
+ *
+ * Returns the engine (free with rr_inc_free), or NULL on failure.
+ */
+struct rr_inc* rr_inc_create(const int* bursts, int plen, int quantum) {
+    if (plen < 0 || (plen > 0 && bursts == NULL) || quantum <= 0) {
+        return NULL;
+    }
+
+    struct rr_inc* e = calloc(1, sizeof(struct rr_inc));
+    if (e == NULL) {
+        return NULL;
+    }
+    e->quantum = quantum;
+    e->root = -1;
+    e->rng = 0x5EEDULL;
+    if (!inc_grow(e, (plen > 16) ? plen : 16)) {
+        rr_inc_free(e);
+        return NULL;
+    }
+
+    struct pcb* procs = (plen > 0) ? init_procs((int*)bursts, plen) : NULL;
+    if (plen > 0 && procs == NULL) {
+        rr_inc_free(e);
+        return NULL;
+    }
+    e->total = rr_analytic_run(procs, plen, quantum);
+
+    e->plen = plen;
+    for (int i = 0; i < plen; i++) {
+        e->burst[i] = bursts[i];
+        e->wait[i] = (bursts[i] > 0) ? procs[i].wait : 0;
+        e->sum_wait += e->wait[i];
+        if (bursts[i] > 0) {
+            e->present++;
+            treap_insert(e, i);
+        }
+    }
+    free(procs);
+    return e;
+}
+
+void rr_inc_free(struct rr_inc* e) {
+    if (e == NULL) {
+        return;
+    }
+    free(e->burst);
+    free(e->wait);
+    free(e->nodes);
+    free(e->changed);
+    free(e);
+}
+
+/** One burst change being applied: b_j goes from old_b to new_b */
+struct inc_update {
+    int j;
+    long long old_b;
+    long long new_b;
+    long long threshold; /* Only processes with a burst above this are affected */
+    long long old_c;
+    long long new_c;
+    long long delta_j;   /* Change of j's own wait */
+};
+
+/**
+ * Visit every present process with burst > u->threshold, in burst
+ * order, settling how the change of b_j moves its wait and how it moves
+ * j's wait.
+ */
+static void inc_visit(struct rr_inc* e, int t, struct inc_update* u) {
+    while (t >= 0) {
+        if (e->burst[t] <= u->threshold) {
+            t = e->nodes[t].right;
+            continue;
+        }
+        inc_visit(e, e->nodes[t].left, u);
+
+        int i = t;
+        if (i != u->j) {
+            long long q = e->quantum;
+            long long b = e->burst[i];
+
+            // Service j gets before i's last slice ends.
+            long long cap_i = q * (rounds(b, q) - 1 + (u->j < i));
+            long long d = min_ll(u->new_b, cap_i) - min_ll(u->old_b, cap_i);
+            if (d != 0) {
+                e->wait[i] += d;
+                e->sum_wait += d;
+                e->changed[e->nchanged++] = i;
+            }
+
+            // Service i gets before j's last slice ends, before and after.
+            long long before = (u->old_b > 0) ? min_ll(b, q * (u->old_c - 1 + (i < u->j))) : 0;
+            long long after = (u->new_b > 0) ? min_ll(b, q * (u->new_c - 1 + (i < u->j))) : 0;
+            u->delta_j += after - before;
+        }
+        t = e->nodes[t].right;
+    }
+}
+
+/**
+ * Change the burst of process `pid` (<= 0 removes it) and update every
+ * wait. Only processes with a burst above q * (ceil(min(old, new) / q) - 1)
+ * are visited.
+ *
+ * Returns the number of processes whose wait changed (see
+ * rr_inc_changed), or -1 if pid is out of range.
+ */
+int rr_inc_set(struct rr_inc* e, int pid, int burst) {
+    if (e == NULL || pid < 0 || pid >= e->plen) {
+        return -1;
+    }
+
+    e->nchanged = 0;
+    long long q = e->quantum;
+    long long old_b = (e->burst[pid] > 0) ? e->burst[pid] : 0;
+    long long new_b = (burst > 0) ? burst : 0;
+    if (old_b == new_b) {
+        e->burst[pid] = burst;
+        return 0;
+    }
+
+    struct inc_update u = { pid, old_b, new_b, 0, rounds(old_b, q), rounds(new_b, q), 0 };
+    u.threshold = q * (rounds(min_ll(old_b, new_b), q) - 1);
+    inc_visit(e, e->root, &u);
+
+    long long new_wait = (new_b > 0) ? ((old_b > 0) ? e->wait[pid] : 0) + u.delta_j : 0;
+    e->sum_wait += new_wait - e->wait[pid];
+    e->wait[pid] = new_wait;
+    e->changed[e->nchanged++] = pid;
+
+    if (old_b > 0) {
+        e->root = treap_erase(e, e->root, pid);
+        e->present--;
+    }
+    e->burst[pid] = burst;
+    if (new_b > 0) {
+        treap_insert(e, pid);
+        e->present++;
+    }
+    e->total += new_b - old_b;
+    return e->nchanged;
+}
+
+/**
+ * Append a process with `burst` (it gets the next pid, last in RR order).
+ *
+ * Returns its pid, or -1 on failure.
+ */
+int rr_inc_insert(struct rr_inc* e, int burst) {
+    if (e == NULL || (e->plen == e->cap && !inc_grow(e, e->cap * 2))) {
+        return -1;
+    }
+    int pid = e->plen++;
+    e->burst[pid] = 0;
+    e->wait[pid] = 0;
+    rr_inc_set(e, pid, burst);
+    return pid;
+}
+
+/**
+ * Remove process `pid`. Its pid stays allocated with a burst of 0 so the
+ * order of the others does not change.
+ *
+ * Returns the number of processes whose wait changed, or -1.
+ */
+int rr_inc_delete(struct rr_inc* e, int pid) {
+    return rr_inc_set(e, pid, 0);
+}
+
+int rr_inc_len(const struct rr_inc* e) {
+    return e->plen;
+}
+
+int rr_inc_wait(const struct rr_inc* e, int pid) {
+    return (pid >= 0 && pid < e->plen) ? (int)e->wait[pid] : 0;
+}
+
+/** Total time of the run: the sum of positive bursts. */
+long long rr_inc_total(const struct rr_inc* e) {
+    return e->total;
+}
+
+/** Mean wait over the processes with a positive burst. */
+double rr_inc_avg_wait(const struct rr_inc* e) {
+    return (e->present > 0) ? (double)e->sum_wait / e->present : 0.0;
+}
+
+/**
+ * Point *pids at the processes whose wait changed in the last update.
+ *
+ * Returns how many there are.
+ */
+int rr_inc_changed(const struct rr_inc* e, const int** pids) {
+    *pids = e->changed;
+    return e->nchanged;
+}
+
+/**
+ * Write the PCBs rr_run would leave behind: every present process
+ * complete with its wait, absent ones untouched.
+ */
+void rr_inc_export(const struct rr_inc* e, struct pcb* procs) {
+    for (int i = 0; i < e->plen; i++) {
+        procs[i].pid = i;
+        procs[i].burst_left = (e->burst[i] > 0) ? 0 : e->burst[i];
+        procs[i].wait = (int)e->wait[i];
+        procs[i].priority = 0;
+    }
+}
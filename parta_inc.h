@@ -0,0 +1,38 @@
+#pragma once
+
+#include "parta.h"
+
+/**
+ * Incremental Round-Robin engine. All processes arrive at time 0 and
+ * run in pid order, as in rr_run, so the wait of process i has the
+ * closed form
+ *
+ *   wait_i = sum over j != i of min(b_j, q * (c_i - 1 + [j < i]))
+ *
+ * where b is the burst, q the quantum and c_i = ceil(b_i / q) the number
+ * of rounds i needs: before i's last slice ends, every earlier process
+ * has had c_i quanta and every later one c_i - 1, or less if it finished.
+ *
+ * Changing b_j from `old` to `new` can then only change the wait of
+ * processes with b_i > q * (ceil(min(old, new) / q) - 1), which a treap
+ * keyed by (burst, pid) enumerates in order, so an update costs
+ * O(log n + k) for k affected processes.
+ */
+struct rr_inc;
+
+
+int rr_analytic_run(struct pcb* procs, int plen, int quantum);
+
+struct rr_inc* rr_inc_create(const int* bursts, int plen, int quantum);
+void rr_inc_free(struct rr_inc* e);
+
+int rr_inc_set(struct rr_inc* e, int pid, int burst);
+int rr_inc_insert(struct rr_inc* e, int burst);
+int rr_inc_delete(struct rr_inc* e, int pid);
+
+int rr_inc_len(const struct rr_inc* e);
+int rr_inc_wait(const struct rr_inc* e, int pid);
+long long rr_inc_total(const struct rr_inc* e);
+double rr_inc_avg_wait(const struct rr_inc* e);
+int rr_inc_changed(const struct rr_inc* e, const int** pids);
+void rr_inc_export(const struct rr_inc* e, struct pcb* procs);
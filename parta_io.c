@@ -0,0 +1,292 @@
+#include "parta_io.h"
+#include <stdlib.h>
+#include <string.h>
+
+/** Per-process simulation state */
+struct io_proc {
+    int phase;       /* Index into the pooled phases array */
+    int left;        /* Time left in the current CPU burst */
+    int ready_since; /* When the process last joined the ready queue */
+};
+
+/** Blocked process, ordered by (I/O completion time, pid) */
+struct io_block {
+    int until;
+    int pid;
+};
+
+/**
+ * Simulation state: a FIFO ready queue (each process is queued at most
+ * once, so a ring of plen slots is enough) and a min-heap of blocked
+ * processes keyed on I/O completion.
+ */
+struct io_sim {
+    const struct io_workload* w;
+    struct pcb* procs;
+    struct io_proc* st;
+    int* ready;
+    int head;
+    int count;
+    struct io_block* blocked;
+    int nblocked;
+    int finished;
+    int last_finish;
+};
+
+/**
+ * Build a workload from per-process phase lists. counts[i] phases of
+ * process i are taken in order from `phases` (CPU, I/O, CPU, ...).
+ *
+ * Returns the workload (free with io_free), or NULL on failure.
+ */
+struct io_workload* io_init(const int* phases, const int* counts, int plen) {
+    if (phases == NULL || counts == NULL || plen <= 0) {
+        return NULL;
+    }
+
+    struct io_workload* w = malloc(sizeof(struct io_workload));
+    if (w == NULL) {
+        return NULL;
+    }
+    w->plen = plen;
+    w->start = malloc(sizeof(int) * (plen + 1));
+    if (w->start == NULL) {
+        free(w);
+        return NULL;
+    }
+
+    w->start[0] = 0;
+    for (int i = 0; i < plen; i++) {
+        if (counts[i] < 0) {
+            free(w->start);
+            free(w);
+            return NULL;
+        }
+        w->start[i + 1] = w->start[i] + counts[i];
+    }
+
+    int total = w->start[plen];
+    w->phases = malloc(sizeof(int) * (total > 0 ? total : 1));
+    if (w->phases == NULL) {
+        free(w->start);
+        free(w);
+        return NULL;
+    }
+    memcpy(w->phases, phases, sizeof(int) * total);
+    return w;
+}
+
+void io_free(struct io_workload* w) {
+    if (w == NULL) {
+        return;
+    }
+    free(w->phases);
+    free(w->start);
+    free(w);
+}
+
+static bool block_before(const struct io_block* a, const struct io_block* b) {
+    return (a->until != b->until) ? a->until < b->until : a->pid < b->pid;
+}
+
+static void block_push(struct io_sim* s, int pid, int until) {
+    struct io_block node = { until, pid };
+    int i = s->nblocked++;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!block_before(&node, &s->blocked[parent])) {
+            break;
+        }
+        s->blocked[i] = s->blocked[parent];
+        i = parent;
+    }
+    s->blocked[i] = node;
+}
+
+static struct io_block block_pop(struct io_sim* s) {
+    struct io_block top = s->blocked[0];
+    struct io_block last = s->blocked[--s->nblocked];
+
+    int i = 0;
+    while (1) {
+        int child = 2 * i + 1;
+        if (child >= s->nblocked) {
+            break;
+        }
+        if (child + 1 < s->nblocked && block_before(&s->blocked[child + 1], &s->blocked[child])) {
+            child++;
+        }
+        if (!block_before(&s->blocked[child], &last)) {
+            break;
+        }
+        s->blocked[i] = s->blocked[child];
+        i = child;
+    }
+    if (s->nblocked > 0) {
+        s->blocked[i] = last;
+    }
+    return top;
+}
+
+static void ready_push(struct io_sim* s, int pid, int now) {
+    s->ready[(s->head + s->count) % s->w->plen] = pid;
+    s->count++;
+    s->st[pid].ready_since = now;
+}
+
+static int ready_pop(struct io_sim* s) {
+    int pid = s->ready[s->head];
+    s->head = (s->head + 1) % s->w->plen;
+    s->count--;
+    return pid;
+}
+
+/**
+ * Move process `pid` to its next non-empty phase at time `now`: queue
+ * it for the CPU, block it on I/O, or mark it complete.
+ */
+static void io_advance(struct io_sim* s, int pid, int now) {
+    struct io_proc* p = &s->st[pid];
+    int end = s->w->start[pid + 1];
+
+    while (++p->phase < end) {
+        int len = s->w->phases[p->phase];
+        if (len <= 0) {
+            continue;
+        }
+        if ((p->phase - s->w->start[pid]) % 2 == 0) {
+            p->left = len;
+            ready_push(s, pid, now);
+        } else {
+            block_push(s, pid, now + len);
+        }
+        return;
+    }
+
+    s->finished++;
+    if (now > s->last_finish) {
+        s->last_finish = now;
+    }
+}
+
+/** Wake every process whose I/O has completed by `now`, in completion order. */
+static void io_wake(struct io_sim* s, int now) {
+    while (s->nblocked > 0 && s->blocked[0].until <= now) {
+        struct io_block b = block_pop(s);
+        io_advance(s, b.pid, b.until);
+    }
+}
+
+/**
+ * Shared engine for io_fcfs_run and io_rr_run (quantum 0 means FCFS).
+ * Processes that finish I/O during a slice join the ready queue before
+ * the preempted process does.
+ */
+static int io_run(const struct io_workload* w, int quantum, struct pcb* procs,
+                  struct io_stats* stats) {
+    if (w == NULL || procs == NULL || quantum < 0) {
+        return 0;
+    }
+
+    struct io_sim s = { 0 };
+    s.w = w;
+    s.procs = procs;
+    s.st = malloc(sizeof(struct io_proc) * w->plen);
+    s.ready = malloc(sizeof(int) * w->plen);
+    s.blocked = malloc(sizeof(struct io_block) * w->plen);
+    if (s.st == NULL || s.ready == NULL || s.blocked == NULL) {
+        free(s.st);
+        free(s.ready);
+        free(s.blocked);
+        return 0;
+    }
+
+    for (int i = 0; i < w->plen; i++) {
+        int cpu = 0;
+        for (int k = w->start[i]; k < w->start[i + 1]; k += 2) {
+            if (w->phases[k] > 0) {
+                cpu += w->phases[k];
+            }
+        }
+        procs[i].pid = i;
+        procs[i].burst_left = cpu;
+        procs[i].wait = 0;
+        procs[i].priority = 0;
+
+        s.st[i].phase = w->start[i] - 1;
+        io_advance(&s, i, 0);
+    }
+
+    int now = 0;
+    int busy = 0;
+    while (s.count > 0 || s.nblocked > 0) {
+        if (s.count == 0) {
+            // CPU idle: jump straight to the next I/O completion.
+            if (s.blocked[0].until > now) {
+                now = s.blocked[0].until;
+            }
+            io_wake(&s, now);
+            continue;
+        }
+
+        int pid = ready_pop(&s);
+        struct io_proc* p = &s.st[pid];
+        procs[pid].wait += now - p->ready_since;
+
+        int run_time = p->left;
+        if (quantum > 0 && quantum < run_time) {
+            run_time = quantum;
+        }
+        now += run_time;
+        busy += run_time;
+        p->left -= run_time;
+        procs[pid].burst_left -= run_time;
+
+        io_wake(&s, now);
+        if (p->left > 0) {
+            ready_push(&s, pid, now);
+        } else {
+            io_advance(&s, pid, now);
+        }
+    }
+
+    if (stats != NULL) {
+        stats->total_time = s.last_finish;
+        stats->busy = busy;
+        stats->completed = s.finished;
+        stats->utilization = (s.last_finish > 0) ? (double)busy / s.last_finish : 0.0;
+        stats->throughput = (s.last_finish > 0) ? (double)s.finished / s.last_finish : 0.0;
+    }
+
+    free(s.st);
+    free(s.ready);
+    free(s.blocked);
+    return s.last_finish;
+}
+
+/**
+ * Run a multi-phase workload with FCFS: the CPU runs each CPU burst to
+ * completion while other processes overlap their I/O.
+ *
+ * procs (plen entries) receives one PCB per process with the total time
+ * spent in the ready queue as its wait.
+ *
+ * Returns the total time elapsed when all processes are complete.
+ */
+int io_fcfs_run(const struct io_workload* w, struct pcb* procs, struct io_stats* stats) {
+    return io_run(w, 0, procs, stats);
+}
+
+/**
+ * Run a multi-phase workload with Round-Robin: each CPU burst runs for
+ * at most `quantum` before the process goes to the back of the ready queue.
+ *
+ * Returns the total time elapsed when all processes are complete.
+ */
+int io_rr_run(const struct io_workload* w, int quantum, struct pcb* procs,
+              struct io_stats* stats) {
+    if (quantum <= 0) {
+        return 0;
+    }
+    return io_run(w, quantum, procs, stats);
+}
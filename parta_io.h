@@ -0,0 +1,32 @@
+#pragma once
+
+#include "parta.h"
+
+/**
+ * A workload of multi-phase processes. Each process alternates CPU and
+ * I/O bursts, starting with CPU: phases[start[i]] is its first CPU burst,
+ * phases[start[i] + 1] its first I/O burst, and so on up to start[i + 1].
+ * All phases live in one pooled array.
+ */
+struct io_workload {
+    int* phases; /** Pooled CPU/I-O burst lengths */
+    int* start;  /** plen + 1 offsets into phases */
+    int plen;    /** Number of processes */
+};
+
+/** Whole-run metrics reported by io_fcfs_run and io_rr_run */
+struct io_stats {
+    int total_time;     /** Time the last process completed */
+    int busy;           /** Time the CPU spent running processes */
+    int completed;      /** Processes that ran all of their phases */
+    double utilization; /** busy / total_time */
+    double throughput;  /** Completed processes per unit of time */
+};
+
+
+struct io_workload* io_init(const int* phases, const int* counts, int plen);
+void io_free(struct io_workload* w);
+
+int io_fcfs_run(const struct io_workload* w, struct pcb* procs, struct io_stats* stats);
+int io_rr_run(const struct io_workload* w, int quantum, struct pcb* procs,
+              struct io_stats* stats);
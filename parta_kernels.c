@@ -0,0 +1,495 @@
+#include "parta_kernels.h"
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+/*
+ * Each kernel is written once as an always-inline body and instantiated
+ * per instruction set with a target attribute, so the compiler can
+ * vectorize every copy for its own ISA. The best copy the CPU supports
+ * is picked once, on first use.
+ */
+
+/**
+ * Wait update from run_proc: every process other than `current` with
+ * burst_left > 0 waits run_time. Written as an unconditional masked add
+ * followed by a fix-up for current so the loop has no branches.
+ */
+static inline __attribute__((always_inline))
+void wait_update_body(struct pcb* procs, int plen, int current, int run_time) {
+    for (int i = 0; i < plen; i++) {
+        procs[i].wait += (procs[i].burst_left > 0) ? run_time : 0;
+    }
+    if (procs[current].burst_left > 0) {
+        procs[current].wait -= run_time;
+    }
+}
+
+/** The SoA form of the wait update, same rules as wait_update_body. */
+static inline __attribute__((always_inline))
+void wait_update_soa_body(struct pcb_soa* soa, int current, int run_time) {
+    const int* burst = soa->burst_left;
+    int* wait = soa->wait;
+    for (int i = 0; i < soa->plen; i++) {
+        wait[i] += (burst[i] > 0) ? run_time : 0;
+    }
+    if (burst[current] > 0) {
+        wait[current] -= run_time;
+    }
+}
+
+/**
+ * FCFS as an exclusive prefix sum: each process with burst_left > 0
+ * waits for the sum of the earlier positive bursts, then completes.
+ *
+ * Returns the total time (the sum of positive bursts).
+ */
+static inline __attribute__((always_inline))
+int fcfs_prefix_body(struct pcb* procs, int plen) {
+    int sum = 0;
+    for (int i = 0; i < plen; i++) {
+        int b = procs[i].burst_left;
+        if (b > 0) {
+            procs[i].wait += sum;
+            procs[i].burst_left = 0;
+            sum += b;
+        }
+    }
+    return sum;
+}
+
+/**
+ * RR round skip: if every runnable process still needs more than k full
+ * quanta, the next k rounds cannot change the RR order, so they are
+ * applied at once: each runnable process runs k * quantum and waits for
+ * the others' (cnt - 1) * k * quantum.
+ *
+ * Returns the time skipped (0 if not even one round can be skipped).
+ */
+static inline __attribute__((always_inline))
+int rr_skip_body(struct pcb* procs, int plen, int quantum) {
+    int cnt = 0;
+    int min_rounds = INT_MAX;
+    for (int i = 0; i < plen; i++) {
+        int b = procs[i].burst_left;
+        int rounds = (b > 0) ? (b - 1) / quantum : INT_MAX;
+        cnt += (b > 0);
+        min_rounds = (rounds < min_rounds) ? rounds : min_rounds;
+    }
+    if (cnt == 0 || min_rounds == 0) {
+        return 0;
+    }
+
+    long long round = (long long)cnt * quantum;
+    long long k = min_rounds;
+    if (k * round > INT_MAX) {
+        k = INT_MAX / round;
+        if (k == 0) {
+            return 0;
+        }
+    }
+
+    int run = (int)(k * quantum);
+    int wait = (int)(k * (round - quantum));
+    for (int i = 0; i < plen; i++) {
+        bool live = procs[i].burst_left > 0;
+        procs[i].burst_left -= live ? run : 0;
+        procs[i].wait += live ? wait : 0;
+    }
+    return (int)(k * round);
+}
+
+#define DEFINE_KERNELS(suffix, attr)                                                 \
+    static attr int fcfs_prefix_##suffix(struct pcb* procs, int plen) {             \
+        return fcfs_prefix_body(procs, plen);                                       \
+    }                                                                               \
+    static attr int rr_skip_##suffix(struct pcb* procs, int plen, int quantum) {    \
+        return rr_skip_body(procs, plen, quantum);                                  \
+    }
+
+#define DEFINE_WAIT_KERNELS(suffix, attr)                                              \
+    static attr void wait_update_##suffix(struct pcb* procs, int plen, int current,   \
+                                          int run_time) {                             \
+        wait_update_body(procs, plen, current, run_time);                             \
+    }                                                                                 \
+    static attr void wait_update_soa_##suffix(struct pcb_soa* soa, int current,       \
+                                              int run_time) {                         \
+        wait_update_soa_body(soa, current, run_time);                                 \
+    }
+
+#define KERNEL_OPS(name, suffix) \
+    { name, wait_update_##suffix, wait_update_soa_##suffix, fcfs_prefix_##suffix, rr_skip_##suffix }
+
+#if defined(__x86_64__) || defined(__i386__)
+#define KERNELS_X86 1
+#else
+#define KERNELS_X86 0
+#endif
+
+DEFINE_KERNELS(scalar, )
+DEFINE_WAIT_KERNELS(scalar, )
+#if KERNELS_X86
+DEFINE_KERNELS(sse42, __attribute__((target("sse4.2"))))
+DEFINE_WAIT_KERNELS(sse42, __attribute__((target("sse4.2"))))
+DEFINE_KERNELS(avx2, __attribute__((target("avx2"))))
+DEFINE_KERNELS(avx512, __attribute__((target("avx512f"))))
+
+/*
+ * Hand-vectorized wait updates. The AoS kernels rely on struct pcb being
+ * four ints (pid, burst_left, wait, priority), so a vector holds whole
+ * PCBs: compare every lane against 0, move the burst_left lane's mask
+ * onto the wait lane of the same PCB, and add run_time there. No gathers.
+ */
+_Static_assert(sizeof(struct pcb) == 4 * sizeof(int), "AoS kernels expect a 16-byte pcb");
+_Static_assert(offsetof(struct pcb, burst_left) == 1 * sizeof(int), "burst_left is lane 1");
+_Static_assert(offsetof(struct pcb, wait) == 2 * sizeof(int), "wait is lane 2");
+
+/** AVX2 AoS: 8 PCBs (four 256-bit vectors of two PCBs) per iteration. */
+__attribute__((target("avx2")))
+static void wait_update_avx2(struct pcb* procs, int plen, int current, int run_time) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i add = _mm256_setr_epi32(0, 0, run_time, 0, 0, 0, run_time, 0);
+    __m256i* v = (__m256i*)procs;
+
+    int i = 0;
+    for (; i + 8 <= plen; i += 8, v += 4) {
+        for (int k = 0; k < 4; k++) {
+            __m256i x = _mm256_loadu_si256(v + k);
+            // Lane 2 of each PCB takes lane 1's (burst_left > 0) mask.
+            __m256i live = _mm256_shuffle_epi32(_mm256_cmpgt_epi32(x, zero),
+                                                _MM_SHUFFLE(3, 1, 1, 0));
+            _mm256_storeu_si256(v + k, _mm256_add_epi32(x, _mm256_and_si256(live, add)));
+        }
+    }
+    for (; i < plen; i++) {
+        procs[i].wait += (procs[i].burst_left > 0) ? run_time : 0;
+    }
+
+    if (procs[current].burst_left > 0) {
+        procs[current].wait -= run_time;
+    }
+}
+
+/** AVX2 SoA: 16 PCBs (two vectors of burst_left and wait) per iteration. */
+__attribute__((target("avx2")))
+static void wait_update_soa_avx2(struct pcb_soa* soa, int current, int run_time) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i add = _mm256_set1_epi32(run_time);
+    const int* burst = soa->burst_left;
+    int* wait = soa->wait;
+
+    int i = 0;
+    for (; i + 16 <= soa->plen; i += 16) {
+        __m256i b0 = _mm256_loadu_si256((const __m256i*)(burst + i));
+        __m256i b1 = _mm256_loadu_si256((const __m256i*)(burst + i + 8));
+        __m256i w0 = _mm256_loadu_si256((const __m256i*)(wait + i));
+        __m256i w1 = _mm256_loadu_si256((const __m256i*)(wait + i + 8));
+        w0 = _mm256_add_epi32(w0, _mm256_and_si256(_mm256_cmpgt_epi32(b0, zero), add));
+        w1 = _mm256_add_epi32(w1, _mm256_and_si256(_mm256_cmpgt_epi32(b1, zero), add));
+        _mm256_storeu_si256((__m256i*)(wait + i), w0);
+        _mm256_storeu_si256((__m256i*)(wait + i + 8), w1);
+    }
+    for (; i < soa->plen; i++) {
+        wait[i] += (burst[i] > 0) ? run_time : 0;
+    }
+
+    if (burst[current] > 0) {
+        wait[current] -= run_time;
+    }
+}
+
+/** AVX-512 AoS: 16 PCBs (four vectors of four PCBs) per iteration. */
+__attribute__((target("avx512f")))
+static void wait_update_avx512(struct pcb* procs, int plen, int current, int run_time) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i add = _mm512_set1_epi32(run_time);
+    const __mmask16 wait_lanes = 0x4444;
+    __m512i* v = (__m512i*)procs;
+
+    int i = 0;
+    for (; i + 16 <= plen; i += 16, v += 4) {
+        for (int k = 0; k < 4; k++) {
+            __m512i x = _mm512_loadu_si512(v + k);
+            // burst_left lane mask shifted onto the wait lane.
+            __mmask16 live = (__mmask16)(_mm512_cmpgt_epi32_mask(x, zero) << 1) & wait_lanes;
+            _mm512_storeu_si512(v + k, _mm512_mask_add_epi32(x, live, x, add));
+        }
+    }
+    for (; i < plen; i++) {
+        procs[i].wait += (procs[i].burst_left > 0) ? run_time : 0;
+    }
+
+    if (procs[current].burst_left > 0) {
+        procs[current].wait -= run_time;
+    }
+}
+
+/** AVX-512 SoA: 16 PCBs per iteration with a compare mask. */
+__attribute__((target("avx512f")))
+static void wait_update_soa_avx512(struct pcb_soa* soa, int current, int run_time) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i add = _mm512_set1_epi32(run_time);
+    const int* burst = soa->burst_left;
+    int* wait = soa->wait;
+
+    int i = 0;
+    for (; i + 16 <= soa->plen; i += 16) {
+        __mmask16 live = _mm512_cmpgt_epi32_mask(_mm512_loadu_si512(burst + i), zero);
+        __m512i w = _mm512_loadu_si512(wait + i);
+        _mm512_storeu_si512(wait + i, _mm512_mask_add_epi32(w, live, w, add));
+    }
+    for (; i < soa->plen; i++) {
+        wait[i] += (burst[i] > 0) ? run_time : 0;
+    }
+
+    if (burst[current] > 0) {
+        wait[current] -= run_time;
+    }
+}
+#endif
+
+static const struct kernel_ops variants[KERNEL_ISA_COUNT] = {
+    KERNEL_OPS("scalar", scalar),
+#if KERNELS_X86
+    KERNEL_OPS("sse4.2", sse42),
+    KERNEL_OPS("avx2", avx2),
+    KERNEL_OPS("avx512", avx512),
+#endif
+};
+
+/**
+ * Copy burst_left and wait of plen PCBs into a new SoA layout.
+ *
+ * Returns false on allocation failure.
+ */
+bool pcb_soa_init(struct pcb_soa* soa, const struct pcb* procs, int plen) {
+    if (soa == NULL || procs == NULL || plen <= 0) {
+        return false;
+    }
+
+    soa->burst_left = malloc(sizeof(int) * plen);
+    soa->wait = malloc(sizeof(int) * plen);
+    if (soa->burst_left == NULL || soa->wait == NULL) {
+        pcb_soa_free(soa);
+        return false;
+    }
+    soa->plen = plen;
+    for (int i = 0; i < plen; i++) {
+        soa->burst_left[i] = procs[i].burst_left;
+        soa->wait[i] = procs[i].wait;
+    }
+    return true;
+}
+
+/** Write burst_left and wait back into plen PCBs. */
+void pcb_soa_store(const struct pcb_soa* soa, struct pcb* procs) {
+    for (int i = 0; soa != NULL && procs != NULL && i < soa->plen; i++) {
+        procs[i].burst_left = soa->burst_left[i];
+        procs[i].wait = soa->wait[i];
+    }
+}
+
+void pcb_soa_free(struct pcb_soa* soa) {
+    if (soa == NULL) {
+        return;
+    }
+    free(soa->burst_left);
+    free(soa->wait);
+    soa->burst_left = NULL;
+    soa->wait = NULL;
+    soa->plen = 0;
+}
+
+/**
+ * Whether the running CPU can execute the given variant.
+ */
+bool kernel_supported(enum kernel_isa isa) {
+    switch (isa) {
+    case KERNEL_SCALAR:
+        return true;
+#if KERNELS_X86
+    case KERNEL_SSE42:
+        return __builtin_cpu_supports("sse4.2");
+    case KERNEL_AVX2:
+        return __builtin_cpu_supports("avx2");
+    case KERNEL_AVX512:
+        return __builtin_cpu_supports("avx512f");
+#endif
+    default:
+        return false;
+    }
+}
+
+/**
+ * Return a specific variant, or NULL if this CPU cannot run it.
+ */
+const struct kernel_ops* kernel_variant(enum kernel_isa isa) {
+    if (isa < 0 || isa >= KERNEL_ISA_COUNT || !kernel_supported(isa)) {
+        return NULL;
+    }
+    return &variants[isa];
+}
+
+/**
+ * Pick a variant: the one named by `override` if it is known and
+ * supported, otherwise the best one the CPU supports.
+ */
+const struct kernel_ops* kernel_select(const char* override) {
+    if (override != NULL) {
+        for (int isa = 0; isa < KERNEL_ISA_COUNT; isa++) {
+            const struct kernel_ops* ops = kernel_variant(isa);
+            if (ops != NULL && strcmp(ops->name, override) == 0) {
+                return ops;
+            }
+        }
+    }
+
+    for (int isa = KERNEL_ISA_COUNT - 1; isa > KERNEL_SCALAR; isa--) {
+        const struct kernel_ops* ops = kernel_variant(isa);
+        if (ops != NULL) {
+            return ops;
+        }
+    }
+    return &variants[KERNEL_SCALAR];
+}
+
+/**
+ * The kernels used by the schedulers. Selected on first use from the
+ * CPU features and the PARTA_KERNEL environment variable (scalar,
+ * sse4.2, avx2 or avx512). Concurrent first calls all select the same
+ * table, so the race is harmless.
+ */
+const struct kernel_ops* kernels(void) {
+    static const struct kernel_ops* selected = NULL;
+
+    const struct kernel_ops* ops = __atomic_load_n(&selected, __ATOMIC_ACQUIRE);
+    if (ops == NULL) {
+        ops = kernel_select(getenv("PARTA_KERNEL"));
+        __atomic_store_n(&selected, ops, __ATOMIC_RELEASE);
+    }
+    return ops;
+}
+
+/*
+ * Small-N Round-Robin. With at most 64 processes the runnable set fits in
+ * one word: the next process after `cur` is found by rotating the mask
+ * right by cur + 1 and counting trailing zeros. Bursts and finish times
+ * live in fixed-size stack arrays, one engine per size class, so the
+ * compiler can unroll the per-process loops. Every process arrives at
+ * time 0 and is runnable until it finishes, so its wait is simply its
+ * finish time minus its burst; nothing is updated per slice.
+ */
+
+static inline int rr_small_after(uint64_t mask, int cur) {
+    unsigned int s = (unsigned int)(cur + 1) & 63;
+    uint64_t rot = (mask >> s) | (mask << ((64 - s) & 63));
+    return (int)((__builtin_ctzll(rot) + s) & 63);
+}
+
+#define DEFINE_RR_SMALL(N)                                                                 \
+    static int rr_small_##N(struct pcb* procs, int plen, int quantum) {                   \
+        int burst[N];                                                                      \
+        int finish[N];                                                                     \
+        uint64_t mask = 0;                                                                 \
+        for (int i = 0; i < N; i++) {                                                      \
+            burst[i] = (i < plen && procs[i].burst_left > 0) ? procs[i].burst_left : 0;    \
+            finish[i] = 0;                                                                 \
+            mask |= (uint64_t)(burst[i] > 0) << i;                                         \
+        }                                                                                  \
+        if (mask == 0) {                                                                   \
+            return 0;                                                                      \
+        }                                                                                  \
+                                                                                           \
+        int left[N];                                                                       \
+        for (int i = 0; i < N; i++) {                                                      \
+            left[i] = burst[i];                                                            \
+        }                                                                                  \
+        int now = 0;                                                                       \
+        int cur = __builtin_ctzll(mask);                                                   \
+        for (;;) {                                                                         \
+            if (cur == __builtin_ctzll(mask)) {                                            \
+                /* Round start: skip full rounds in which nobody finishes. */              \
+                int min = INT_MAX;                                                         \
+                for (int i = 0; i < N; i++) {                                              \
+                    min = (left[i] > 0 && left[i] < min) ? left[i] : min;                  \
+                }                                                                          \
+                int k = (min - 1) / quantum;                                               \
+                if (k > 0) {                                                               \
+                    for (int i = 0; i < N; i++) {                                          \
+                        left[i] -= (left[i] > 0) ? k * quantum : 0;                        \
+                    }                                                                      \
+                    now += k * quantum * __builtin_popcountll(mask);                       \
+                }                                                                          \
+            }                                                                              \
+            int run = (left[cur] < quantum) ? left[cur] : quantum;                         \
+            left[cur] -= run;                                                              \
+            now += run;                                                                    \
+            if (left[cur] == 0) {                                                          \
+                finish[cur] = now;                                                         \
+                mask &= ~((uint64_t)1 << cur);                                             \
+                if (mask == 0) {                                                           \
+                    break;                                                                 \
+                }                                                                          \
+            }                                                                              \
+            cur = rr_small_after(mask, cur);                                               \
+        }                                                                                  \
+                                                                                           \
+        for (int i = 0; i < N && i < plen; i++) {                                          \
+            if (burst[i] > 0) {                                                            \
+                procs[i].wait += finish[i] - burst[i];                                     \
+                procs[i].burst_left = 0;                                                   \
+            }                                                                              \
+        }                                                                                  \
+        return now;                                                                        \
+    }                                                                                      \
+    static int rr_small_next_##N(int current, const struct pcb* procs, int plen) {        \
+        uint64_t mask = 0;                                                                 \
+        for (int i = 0; i < N; i++) {                                                      \
+            mask |= (uint64_t)(i < plen && procs[i].burst_left > 0) << i;                  \
+        }                                                                                  \
+        return (mask == 0) ? -1 : rr_small_after(mask, current);                           \
+    }
+
+DEFINE_RR_SMALL(8)
+DEFINE_RR_SMALL(16)
+DEFINE_RR_SMALL(32)
+DEFINE_RR_SMALL(64)
+
+/**
+ * rr_run for plen <= RR_SMALL_MAX, on the smallest engine that fits.
+ *
+ * Returns the total time, or -1 if plen is too large.
+ */
+int rr_small_run(struct pcb* procs, int plen, int quantum) {
+    if (plen <= 8) {
+        return rr_small_8(procs, plen, quantum);
+    } else if (plen <= 16) {
+        return rr_small_16(procs, plen, quantum);
+    } else if (plen <= 32) {
+        return rr_small_32(procs, plen, quantum);
+    } else if (plen <= 64) {
+        return rr_small_64(procs, plen, quantum);
+    }
+    return -1;
+}
+
+/**
+ * rr_next for plen <= RR_SMALL_MAX and -1 <= current < plen.
+ *
+ * Returns the next runnable process after current, or -1 if none is.
+ */
+int rr_small_next(int current, const struct pcb* procs, int plen) {
+    if (plen <= 8) {
+        return rr_small_next_8(current, procs, plen);
+    } else if (plen <= 16) {
+        return rr_small_next_16(current, procs, plen);
+    } else if (plen <= 32) {
+        return rr_small_next_32(current, procs, plen);
+    }
+    return rr_small_next_64(current, procs, plen);
+}
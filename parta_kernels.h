@@ -0,0 +1,45 @@
+#pragma once
+
+#include "parta.h"
+
+/** Instruction-set variants of the hot loops, in increasing order of requirements */
+enum kernel_isa {
+    KERNEL_SCALAR,
+    KERNEL_SSE42,
+    KERNEL_AVX2,
+    KERNEL_AVX512,
+    KERNEL_ISA_COUNT,
+};
+
+/** Structure-of-arrays copy of the fields the wait update touches */
+struct pcb_soa {
+    int* burst_left; /** burst_left of each PCB */
+    int* wait;       /** wait of each PCB */
+    int plen;        /** Number of PCBs */
+};
+
+/** One implementation of every dispatched kernel */
+struct kernel_ops {
+    const char* name; /** Name accepted by the PARTA_KERNEL override */
+    void (*wait_update)(struct pcb* procs, int plen, int current, int run_time);
+    void (*wait_update_soa)(struct pcb_soa* soa, int current, int run_time);
+    int (*fcfs_prefix)(struct pcb* procs, int plen);
+    int (*rr_skip)(struct pcb* procs, int plen, int quantum);
+};
+
+
+/** Largest plen handled by the one-word Round-Robin engines */
+#define RR_SMALL_MAX 64
+
+
+bool kernel_supported(enum kernel_isa isa);
+const struct kernel_ops* kernel_variant(enum kernel_isa isa);
+const struct kernel_ops* kernel_select(const char* override);
+const struct kernel_ops* kernels(void);
+
+bool pcb_soa_init(struct pcb_soa* soa, const struct pcb* procs, int plen);
+void pcb_soa_store(const struct pcb_soa* soa, struct pcb* procs);
+void pcb_soa_free(struct pcb_soa* soa);
+
+int rr_small_run(struct pcb* procs, int plen, int quantum);
+int rr_small_next(int current, const struct pcb* procs, int plen);
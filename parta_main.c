@@ -1,132 +1,1084 @@
 #include "parta.h"
+#include "parta_algo.h"
+#include "parta_cache.h"
+#include "parta_cli.h"
+#include "parta_server.h"
+#include "parta_stream.h"
+#include "parta_ooc.h"
+#include "parta_opt.h"
+#include "parta_mc.h"
+#include "parta_smp.h"
+#include "parta_group.h"
+#include "parta_hrrn.h"
+#include <fcntl.h>
+#include <signal.h>
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
 #include <stdio.h>
+#include <unistd.h>
+
+/** Most algorithms one compare run accepts */
+#define MAX_SPECS 16
 
 static void print_missing_args_error(void) {
     printf("ERROR: Missing arguments\n");
 }
 
+static void print_invalid_arg_error(const char* arg) {
+    printf("ERROR: Invalid argument '%s'\n", arg);
+}
+
 /**
- * Command-line driver for the CPU scheduler.
- *
- * Usage:
- *   ./parta_main fcfs <burst1> <burst2> ...
- *   ./parta_main rr <quantum> <burst1> <burst2> ...
+ * Parse `plen` burst arguments (burst, or burst:prio when with_priority
+ * is set) into a fresh PCB array.
  *
- * On success, prints:
- *   - The algorithm used
- *   - List of accepted processes and bursts
- *   - Average wait time (2 decimal places)
+ * Returns the PCBs, or NULL after printing an error.
+ */
+static struct pcb* parse_procs(char* args[], int plen, bool with_priority) {
+    int* bursts = malloc(sizeof(int) * plen);
+    int* prios = malloc(sizeof(int) * plen);
+    if (bursts == NULL || prios == NULL) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        free(bursts);
+        free(prios);
+        return NULL;
+    }
+
+    for (int i = 0; i < plen; i++) {
+        if (!parse_burst(args[i], &bursts[i], with_priority ? &prios[i] : NULL)) {
+            print_invalid_arg_error(args[i]);
+            free(bursts);
+            free(prios);
+            return NULL;
+        }
+    }
+
+    struct pcb* procs = init_procs(bursts, plen);
+    free(bursts);
+    if (procs == NULL) {
+        fprintf(stderr, "ERROR: Failed to initialize processes\n");
+        free(prios);
+        return NULL;
+    }
+
+    for (int i = 0; with_priority && i < plen; i++) {
+        procs[i].priority = prios[i];
+    }
+    free(prios);
+    return procs;
+}
+
+/**
+ * Render the Accepted lines into `out`. Each line is at most ~60 bytes,
+ * so the buffer is sized for all of them up front.
+ */
+static void echo_procs(struct out_buf* out, const struct pcb* procs, int plen,
+                       bool with_priority) {
+    for (int i = 0; i < plen; i++) {
+        out_str(out, "Accepted P");
+        out_int(out, procs[i].pid);
+        out_str(out, ": Burst ");
+        out_int(out, procs[i].burst_left);
+        if (with_priority) {
+            out_str(out, " Priority ");
+            out_int(out, procs[i].priority);
+        }
+        out_char(out, '\n');
+    }
+}
+
+/**
+ * Parse the leading algorithm arguments of a single run: either
+ * "<name> [param]" or an inline spec such as "rr:4".
  *
- * On incorrect/missing arguments, prints an error and exits with status 1.
+ * Returns the number of arguments consumed, or 0 after printing an error.
  */
-int main(int argc, char* argv[]) {
-    if (argc < 2) {
+static int parse_single(int argc, char* argv[], struct sched_spec* spec) {
+    const struct sched_algo* algo = sched_find(argv[1]);
+    if (algo == NULL) {
+        if (strchr(argv[1], ':') != NULL && sched_parse_spec(argv[1], spec)) {
+            return 1;
+        }
+        // Unknown algorithm – treat as incorrect usage.
         print_missing_args_error();
+        return 0;
+    }
+
+    spec->algo = algo;
+    spec->param = 0;
+    if (!(algo->flags & SCHED_PARAM)) {
         return 1;
     }
+    // Need the parameter and at least one burst.
+    if (argc < 4) {
+        print_missing_args_error();
+        return 0;
+    }
+    if (!algo->parse(argv[2], &spec->param)) {
+        print_invalid_arg_error(argv[2]);
+        return 0;
+    }
+    return 2;
+}
 
-    struct pcb* procs = NULL;
+/**
+ * Parse the algorithm specs of a compare run: every argument up to the
+ * first one that starts like a number.
+ *
+ * Returns the number of specs, or 0 after printing an error.
+ */
+static int parse_compare(int argc, char* argv[], struct sched_spec* specs) {
+    int nspecs = 0;
+    for (int i = 2; i < argc; i++) {
+        const char* arg = argv[i];
+        if (isdigit((unsigned char)arg[0]) || arg[0] == '-' || arg[0] == '+') {
+            break;
+        }
+        if (nspecs == MAX_SPECS || !sched_parse_spec(arg, &specs[nspecs])) {
+            print_invalid_arg_error(arg);
+            return 0;
+        }
+        nspecs++;
+    }
 
-    if (strcmp(argv[1], "fcfs") == 0) {
-        // Need at least one burst.
-        if (argc < 3) {
-            print_missing_args_error();
+    // Need at least one algorithm and one burst.
+    if (nspecs == 0 || 2 + nspecs >= argc) {
+        print_missing_args_error();
+        return 0;
+    }
+    return nspecs;
+}
+
+/**
+ * Print a table with one row per spec. The specs run in parallel, each
+ * over its own copy of the parsed PCBs.
+ */
+static bool report_compare(struct out_buf* out, const struct sched_spec* specs, int nspecs,
+                           const struct pcb* procs, int plen) {
+    struct sched_result results[MAX_SPECS];
+    if (!sched_compare(specs, nspecs, procs, plen, 0, results)) {
+        fprintf(stderr, "ERROR: Failed to run algorithms\n");
+        return false;
+    }
+
+    char line[96];
+    snprintf(line, sizeof(line), "%-12s %10s %10s %10s\n", "Algorithm", "Avg wait", "P99 wait",
+             "Total");
+    out_str(out, line);
+    for (int i = 0; i < nspecs; i++) {
+        char label[32];
+        sched_label(&specs[i], label, sizeof(label));
+        snprintf(line, sizeof(line), "%-12s %10.2f %10d %10d\n", label, results[i].avg_wait,
+                 results[i].p99_wait, results[i].total_time);
+        out_str(out, line);
+    }
+    return true;
+}
+
+static struct parta_server* serving = NULL;
+
+static void on_stop_signal(int sig) {
+    (void)sig;
+    server_stop(serving);
+}
+
+/**
+ * Run the simulation server on a Unix socket until SIGINT or SIGTERM:
+ *   ./parta_main serve <socket> [threads] [cache_mb]
+ *
+ * Results are memoized in a cache of cache_mb MiB (default 64, 0 turns
+ * it off), persisted under $PARTA_CACHE_DIR when that is set.
+ */
+static int serve(int argc, char* argv[]) {
+    if (argc < 3) {
+        print_missing_args_error();
+        return 1;
+    }
+
+    struct srv_config config = { argv[2], 0, 0, (size_t)64 << 20, getenv("PARTA_CACHE_DIR") };
+    if (argc > 3 && (!parse_int(argv[3], &config.threads) || config.threads < 0)) {
+        print_invalid_arg_error(argv[3]);
+        return 1;
+    }
+    int cache_mb;
+    if (argc > 4) {
+        if (!parse_int(argv[4], &cache_mb) || cache_mb < 0) {
+            print_invalid_arg_error(argv[4]);
             return 1;
         }
+        config.cache_bytes = (size_t)cache_mb << 20;
+    }
 
-        int plen = argc - 2;
-        int* bursts = malloc(sizeof(int) * plen);
-        if (bursts == NULL) {
-            fprintf(stderr, "ERROR: Memory allocation failed\n");
-            return 1;
+    serving = server_create(&config);
+    if (serving == NULL) {
+        fprintf(stderr, "ERROR: Cannot listen on %s\n", argv[2]);
+        return 1;
+    }
+
+    struct sigaction sa = { 0 };
+    sa.sa_handler = on_stop_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    printf("Serving on %s\n", argv[2]);
+    fflush(stdout);
+    int rc = server_run(serving);
+
+    struct cache_stats stats;
+    if (server_cache_stats(serving, &stats)) {
+        printf("Cache: %lld hits (%lld from disk), %lld misses, %lld evictions\n", stats.hits,
+               stats.disk_hits, stats.misses, stats.evictions);
+    }
+    server_free(serving);
+    return (rc == 0) ? 0 : 1;
+}
+
+/** Arguments of the streaming modes */
+struct stream_args {
+    const char* in_path;  /** Bursts, "-" for stdin */
+    const char* out_path; /** Per-process waits, "-" for stdout, or NULL */
+    const char* tmp_dir;  /** Spill directory (rr-ooc), NULL for the default */
+    int mem_mb;           /** Memory budget in MiB (rr-ooc) */
+    int in_fd;
+    int out_fd;           /** -1 without --out */
+};
+
+/**
+ * Parse "[file|-] [--out file|-]" (plus "[--mem MB] [--tmp dir]" with
+ * spill set) from argv[first..] and open the files.
+ *
+ * Returns false after printing an error.
+ */
+static bool parse_stream_args(int argc, char* argv[], int first, bool spill,
+                              struct stream_args* args) {
+    *args = (struct stream_args){ "-", NULL, NULL, 256, STDIN_FILENO, -1 };
+    bool have_input = false;
+    for (int i = first; i < argc; i++) {
+        bool option = (strcmp(argv[i], "--out") == 0) ||
+                      (spill && (strcmp(argv[i], "--mem") == 0 || strcmp(argv[i], "--tmp") == 0));
+        if (option && i + 1 == argc) {
+            print_missing_args_error();
+            return false;
         }
+        if (strcmp(argv[i], "--out") == 0) {
+            args->out_path = argv[++i];
+        } else if (option && strcmp(argv[i], "--tmp") == 0) {
+            args->tmp_dir = argv[++i];
+        } else if (option) {
+            if (!parse_int(argv[++i], &args->mem_mb) || args->mem_mb <= 0) {
+                print_invalid_arg_error(argv[i]);
+                return false;
+            }
+        } else if (!have_input) {
+            args->in_path = argv[i];
+            have_input = true;
+        } else {
+            print_invalid_arg_error(argv[i]);
+            return false;
+        }
+    }
 
-        for (int i = 0; i < plen; i++) {
-            bursts[i] = atoi(argv[i + 2]);
+    if (strcmp(args->in_path, "-") != 0) {
+        args->in_fd = open(args->in_path, O_RDONLY);
+        if (args->in_fd < 0) {
+            fprintf(stderr, "ERROR: Cannot open %s\n", args->in_path);
+            return false;
+        }
+    }
+    if (args->out_path != NULL) {
+        args->out_fd = (strcmp(args->out_path, "-") == 0)
+                           ? STDOUT_FILENO
+                           : open(args->out_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (args->out_fd < 0) {
+            fprintf(stderr, "ERROR: Cannot open %s\n", args->out_path);
+            if (args->in_fd != STDIN_FILENO) {
+                close(args->in_fd);
+            }
+            return false;
         }
+    }
+    return true;
+}
 
-        procs = init_procs(bursts, plen);
-        free(bursts);
+static void close_stream_args(struct stream_args* args) {
+    if (args->in_fd != STDIN_FILENO) {
+        close(args->in_fd);
+    }
+    if (args->out_fd >= 0 && args->out_fd != STDOUT_FILENO) {
+        close(args->out_fd);
+    }
+}
 
-        if (procs == NULL) {
-            fprintf(stderr, "ERROR: Failed to initialize processes\n");
-            return 1;
-        }
+/**
+ * Print why a streaming run failed.
+ *
+ * Returns true if it did not.
+ */
+static bool report_stream_status(enum stream_status status, long long bad_pid,
+                                 const struct stream_args* args) {
+    if (status == STREAM_EINPUT) {
+        printf("ERROR: Invalid burst for P%lld\n", bad_pid);
+    } else if (status == STREAM_EREAD) {
+        fprintf(stderr, "ERROR: Cannot read %s\n", args->in_path);
+    } else if (status == STREAM_EWRITE) {
+        fprintf(stderr, "ERROR: Cannot write %s\n", args->out_path);
+    } else if (status == STREAM_ENOMEM) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+    } else if (status == STREAM_ETMP) {
+        fprintf(stderr, "ERROR: Cannot use spill files in %s\n",
+                (args->tmp_dir != NULL) ? args->tmp_dir : "the temp dir");
+    }
+    return status == STREAM_OK;
+}
 
-        printf("Using FCFS\n\n");
+/** Print the summary of a streaming run. */
+static bool report_stream(const char* header, long long plen, double avg_wait, long long p50,
+                          long long p99, long long max, long long total) {
+    struct out_buf out;
+    out_init(&out, STDOUT_FILENO, 256);
+    out_str(&out, header);
+    out_str(&out, "\n\nProcesses: ");
+    out_ll(&out, plen);
+    out_str(&out, "\nAverage wait time: ");
+    out_fixed2(&out, avg_wait);
+    out_str(&out, "\nP50 wait: ");
+    out_ll(&out, p50);
+    out_str(&out, "\nP99 wait: ");
+    out_ll(&out, p99);
+    out_str(&out, "\nMax wait: ");
+    out_ll(&out, max);
+    out_str(&out, "\nTotal time: ");
+    out_ll(&out, total);
+    out_char(&out, '\n');
+    bool ok = out_flush(&out);
+    out_free(&out);
+    return ok;
+}
 
-        for (int i = 0; i < plen; i++) {
-            printf("Accepted P%d: Burst %d\n", procs[i].pid, procs[i].burst_left);
+/**
+ * Run FCFS over bursts streamed from a file or stdin, in O(1) memory:
+ *   ./parta_main fcfs --stream [file|-] [--out file|-]
+ *
+ * With --out, every process' "<pid> <wait>" line is written there as it
+ * is computed. The summary is printed once the input ends.
+ */
+static int stream_fcfs(int argc, char* argv[]) {
+    struct stream_args args;
+    if (!parse_stream_args(argc, argv, 3, false, &args)) {
+        return 1;
+    }
+
+    struct fcfs_stream* stream = malloc(sizeof(struct fcfs_stream));
+    if (stream == NULL) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        close_stream_args(&args);
+        return 1;
+    }
+    fcfs_stream_init(stream);
+    struct out_buf per_proc;
+    out_init(&per_proc, args.out_fd, (size_t)1 << 20);
+    enum stream_status status =
+        fcfs_stream_fd(stream, args.in_fd, (args.out_fd >= 0) ? &per_proc : NULL);
+    out_free(&per_proc);
+    close_stream_args(&args);
+
+    bool ok = report_stream_status(status, stream->n, &args) &&
+              report_stream("Using FCFS", stream->n, fcfs_stream_avg_wait(stream),
+                            sketch_quantile(&stream->waits, 0.50),
+                            sketch_quantile(&stream->waits, 0.99), stream->waits.max,
+                            stream->clock);
+    free(stream);
+    return ok ? 0 : 1;
+}
+
+/**
+ * Run Round-Robin over bursts from a file or stdin within a memory
+ * budget, spilling to disk (see parta_ooc.h):
+ *   ./parta_main rr-ooc <quantum> [file|-] [--out file|-] [--mem MB] [--tmp dir]
+ *
+ * With --out, the waits are written there in pid order.
+ */
+static int ooc_rr(int argc, char* argv[]) {
+    int quantum;
+    if (argc < 3) {
+        print_missing_args_error();
+        return 1;
+    }
+    if (!parse_int(argv[2], &quantum) || quantum <= 0) {
+        print_invalid_arg_error(argv[2]);
+        return 1;
+    }
+    struct stream_args args;
+    if (!parse_stream_args(argc, argv, 3, true, &args)) {
+        return 1;
+    }
+
+    struct ooc_config config = { args.tmp_dir, (size_t)args.mem_mb << 20 };
+    struct ooc_result result;
+    struct out_buf per_proc;
+    out_init(&per_proc, args.out_fd, (size_t)1 << 20);
+    enum stream_status status =
+        rr_ooc_run(args.in_fd, quantum, &config, (args.out_fd >= 0) ? &per_proc : NULL, &result);
+    out_free(&per_proc);
+    close_stream_args(&args);
+
+    char header[48];
+    snprintf(header, sizeof(header), "Using RR(%d).", quantum);
+    bool ok = report_stream_status(status, result.plen, &args) &&
+              report_stream(header, result.plen, result.avg_wait, result.p50_wait,
+                            result.p99_wait, result.max_wait, result.total_time);
+    return ok ? 0 : 1;
+}
+
+/**
+ * Search the Round-Robin quantum that minimizes an objective (see
+ * parta_opt.h):
+ *   ./parta_main [--quiet] rr-opt <mean|p99|switch:dispatch> <burst1> <burst2> ...
+ *
+ * "switch:D" charges D ticks per context switch, as rr_run_cost does.
+ */
+static int optimize_rr(int argc, char* argv[], bool quiet) {
+    if (argc < 4) {
+        print_missing_args_error();
+        return 1;
+    }
+
+    struct opt_config config = { OPT_MEAN_WAIT, 0, 0, 0 };
+    if (strcmp(argv[2], "p99") == 0) {
+        config.objective = OPT_P99_WAIT;
+    } else if (strncmp(argv[2], "switch:", 7) == 0) {
+        config.objective = OPT_SWITCH;
+        if (!parse_int(argv[2] + 7, &config.dispatch) || config.dispatch < 0) {
+            print_invalid_arg_error(argv[2]);
+            return 1;
         }
+    } else if (strcmp(argv[2], "mean") != 0) {
+        print_invalid_arg_error(argv[2]);
+        return 1;
+    }
 
-        int total_time = fcfs_run(procs, plen);
-        (void)total_time; // total_time not printed but might be useful/debug
+    int plen = argc - 3;
+    struct pcb* procs = parse_procs(&argv[3], plen, false);
+    if (procs == NULL) {
+        return 1;
+    }
 
-        double sum_wait = 0.0;
-        for (int i = 0; i < plen; i++) {
-            sum_wait += procs[i].wait;
+    struct out_buf out;
+    out_init(&out, STDOUT_FILENO, 256 + (quiet ? 0 : 60 * (size_t)plen));
+    out_str(&out, "Optimizing RR quantum for ");
+    if (config.objective == OPT_SWITCH) {
+        out_str(&out, "mean wait + ");
+        out_int(&out, config.dispatch);
+        out_str(&out, " per switch\n\n");
+    } else {
+        out_str(&out, (config.objective == OPT_P99_WAIT) ? "p99 wait\n\n" : "mean wait\n\n");
+    }
+    if (!quiet) {
+        echo_procs(&out, procs, plen, false);
+        out_char(&out, '\n');
+    }
+
+    struct opt_result result = { 0 };
+    bool ok = rr_optimize(procs, plen, &config, &result);
+    free(procs);
+    if (ok) {
+        out_str(&out, "Best quantum: ");
+        out_int(&out, result.quantum);
+        out_str(&out, "\nAverage wait time: ");
+        out_fixed2(&out, result.avg_wait);
+        if (config.objective == OPT_SWITCH) {
+            out_str(&out, "\nWith switch costs: ");
+            out_fixed2(&out, result.score);
         }
-        double avg_wait = (plen > 0) ? (sum_wait / plen) : 0.0;
+        out_str(&out, "\nP99 wait: ");
+        out_int(&out, result.p99_wait);
+        out_str(&out, "\nTotal time: ");
+        out_int(&out, result.total_time);
+        out_str(&out, "\nQuanta evaluated: ");
+        out_int(&out, result.candidates);
+        out_str(&out, " of ");
+        out_int(&out, result.range);
+        out_char(&out, '\n');
+    }
 
-        printf("Average wait time: %.2f\n", avg_wait);
+    ok = out_flush(&out) && ok;
+    out_free(&out);
+    if (!ok) {
+        fprintf(stderr, "ERROR: Quantum search failed\n");
+        return 1;
+    }
+    return 0;
+}
 
-        free(procs);
-        return 0;
+/** Print "<label>: <mean> +- <95% CI half-width>". */
+static void out_mean_ci(struct out_buf* out, const char* label, const struct welford* w) {
+    out_str(out, label);
+    out_str(out, ": ");
+    out_fixed2(out, w->mean);
+    out_str(out, " +- ");
+    out_fixed2(out, welford_ci95(w));
+    out_char(out, '\n');
+}
 
-    } else if (strcmp(argv[1], "rr") == 0) {
-        // Need at least quantum + one burst.
-        if (argc < 4) {
+/**
+ * Evaluate one algorithm over random workloads (see parta_mc.h):
+ *   ./parta_main mc <algo[:param]> <dist> <procs> [--runs N] [--ci W] [--threads T] [--seed S]
+ *
+ * Runs up to N workloads (default 10000) of <procs> bursts drawn from
+ * <dist>, stopping early once the mean wait is known within +-W (95%).
+ */
+static int monte_carlo(int argc, char* argv[]) {
+    if (argc < 5) {
+        print_missing_args_error();
+        return 1;
+    }
+
+    struct mc_config config = { { NULL, 0 }, { MC_UNIFORM, 1, 1, 0 }, 0, 10000, 0.0, 0, 1 };
+    const struct sched_algo* algo = sched_find(argv[2]);
+    if (algo != NULL && !(algo->flags & SCHED_PARAM)) {
+        config.spec = (struct sched_spec){ algo, 0 };
+    } else if (!sched_parse_spec(argv[2], &config.spec)) {
+        print_invalid_arg_error(argv[2]);
+        return 1;
+    }
+    if (!mc_parse_dist(argv[3], &config.dist)) {
+        print_invalid_arg_error(argv[3]);
+        return 1;
+    }
+    if (!parse_int(argv[4], &config.plen) || config.plen <= 0) {
+        print_invalid_arg_error(argv[4]);
+        return 1;
+    }
+    for (int i = 5; i < argc; i += 2) {
+        if (i + 1 == argc) {
             print_missing_args_error();
             return 1;
         }
+        const char* arg = argv[i + 1];
+        int value = 0;
+        bool valid;
+        if (strcmp(argv[i], "--ci") == 0) {
+            char* end;
+            config.ci_target = strtod(arg, &end);
+            valid = end != arg && *end == '\0' && config.ci_target > 0.0;
+        } else if (strcmp(argv[i], "--runs") == 0 || strcmp(argv[i], "--threads") == 0 ||
+                   strcmp(argv[i], "--seed") == 0) {
+            valid = parse_int(arg, &value) && value >= (strcmp(argv[i], "--runs") == 0);
+        } else {
+            print_invalid_arg_error(argv[i]);
+            return 1;
+        }
+        if (!valid) {
+            print_invalid_arg_error(arg);
+            return 1;
+        }
+        if (strcmp(argv[i], "--runs") == 0) {
+            config.max_runs = value;
+        } else if (strcmp(argv[i], "--threads") == 0) {
+            config.threads = value;
+        } else if (strcmp(argv[i], "--seed") == 0) {
+            config.seed = (unsigned long long)value;
+        }
+    }
+
+    struct mc_result* result = malloc(sizeof(struct mc_result));
+    if (result == NULL || !mc_run(&config, result)) {
+        fprintf(stderr, "ERROR: Monte Carlo run failed\n");
+        free(result);
+        return 1;
+    }
+
+    char label[32];
+    sched_label(&config.spec, label, sizeof(label));
+    struct out_buf out;
+    out_init(&out, STDOUT_FILENO, 512);
+    out_str(&out, "Monte Carlo ");
+    out_str(&out, label);
+    out_str(&out, " over ");
+    out_int(&out, config.plen);
+    out_str(&out, " x ");
+    out_str(&out, argv[3]);
+    out_str(&out, "\n\nWorkloads: ");
+    out_ll(&out, result->runs);
+    out_str(&out, result->converged ? " (converged)\n" : "\n");
+    out_mean_ci(&out, "Average wait time", &result->avg_wait);
+    out_mean_ci(&out, "P99 wait", &result->p99_wait);
+    out_mean_ci(&out, "Total time", &result->total);
+    out_str(&out, "Pooled P50 wait: ");
+    out_ll(&out, sketch_quantile(&result->waits, 0.50));
+    out_str(&out, "\nPooled P99 wait: ");
+    out_ll(&out, sketch_quantile(&result->waits, 0.99));
+    out_char(&out, '\n');
+    bool ok = out_flush(&out);
+    out_free(&out);
+    free(result);
+    return ok ? 0 : 1;
+}
 
-        int quantum = atoi(argv[2]);
-        int plen = argc - 3;
+/**
+ * Run Round-Robin on several CPUs with work stealing (see parta_smp.h):
+ *   ./parta_main [--quiet] smp <cpus> <quantum> <latency> [--threads T] <burst1> ...
+ *
+ * With --threads the simulation itself runs on T host threads (0 for
+ * one per CPU of the host); the result is the same.
+ */
+static int smp(int argc, char* argv[], bool quiet) {
+    if (argc < 6) {
+        print_missing_args_error();
+        return 1;
+    }
 
-        int* bursts = malloc(sizeof(int) * plen);
-        if (bursts == NULL) {
-            fprintf(stderr, "ERROR: Memory allocation failed\n");
+    struct smp_config config;
+    int* fields[] = { &config.cpus, &config.quantum, &config.latency };
+    for (int i = 0; i < 3; i++) {
+        if (!parse_int(argv[2 + i], fields[i]) || *fields[i] <= 0) {
+            print_invalid_arg_error(argv[2 + i]);
+            return 1;
+        }
+    }
+    int threads = -1;
+    int first = 5;
+    if (strcmp(argv[5], "--threads") == 0) {
+        if (argc < 8) {
+            print_missing_args_error();
+            return 1;
+        }
+        if (!parse_int(argv[6], &threads) || threads < 0) {
+            print_invalid_arg_error(argv[6]);
             return 1;
         }
+        first = 7;
+    }
 
+    int plen = argc - first;
+    struct pcb* procs = parse_procs(&argv[first], plen, false);
+    if (procs == NULL) {
+        return 1;
+    }
+
+    struct out_buf out;
+    out_init(&out, STDOUT_FILENO, 256 + (quiet ? 0 : 60 * (size_t)plen));
+    out_str(&out, "Using SMP RR(");
+    out_int(&out, config.quantum);
+    out_str(&out, ") on ");
+    out_int(&out, config.cpus);
+    out_str(&out, " CPUs.\n\n");
+    if (!quiet) {
+        echo_procs(&out, procs, plen, false);
+    }
+
+    struct smp_stats stats;
+    bool ok = (threads < 0) ? smp_run(procs, plen, &config, &stats)
+                            : smp_run_parallel(procs, plen, &config, threads, &stats);
+    if (ok) {
+        long long sum_wait = 0;
         for (int i = 0; i < plen; i++) {
-            bursts[i] = atoi(argv[i + 3]);
+            sum_wait += procs[i].wait;
         }
+        out_str(&out, "Average wait time: ");
+        out_fixed2(&out, (double)sum_wait / plen);
+        out_str(&out, "\nTotal time: ");
+        out_ll(&out, stats.total_time);
+        out_str(&out, "\nSteals: ");
+        out_ll(&out, stats.steals);
+        out_char(&out, '\n');
+    }
+    free(procs);
+
+    ok = out_flush(&out) && ok;
+    out_free(&out);
+    if (!ok) {
+        fprintf(stderr, "ERROR: Simulation failed\n");
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Append a group's path the way the CLI shows it: "/" for the root,
+ * "/web/api" for the group "web/api".
+ */
+static void out_group(struct out_buf* out, const struct group_tree* tree, int id) {
+    out_char(out, '/');
+    out_str(out, group_path(tree, id));
+}
+
+/**
+ * Run processes in nested groups with weighted CPU shares (see
+ * parta_group.h):
+ *   ./parta_main [--quiet] group <quantum> <path=weight | burst[@path]> ...
+ *
+ * "web/api=3" gives the group web/api weight 3, and "12@web/api" is a
+ * process with burst 12 in it. Groups only named by processes get weight
+ * 1; processes without "@path" belong to the root. Pids follow the order
+ * of the bursts.
+ */
+static int group(int argc, char* argv[], bool quiet) {
+    if (argc < 4) {
+        print_missing_args_error();
+        return 1;
+    }
+    int quantum;
+    if (!parse_int(argv[2], &quantum) || quantum <= 0) {
+        print_invalid_arg_error(argv[2]);
+        return 1;
+    }
 
-        procs = init_procs(bursts, plen);
+    struct group_tree* tree = group_create();
+    int* bursts = malloc(sizeof(int) * (argc - 3));
+    int* groups = malloc(sizeof(int) * (argc - 3));
+    if (tree == NULL || bursts == NULL || groups == NULL) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        group_free(tree);
         free(bursts);
+        free(groups);
+        return 1;
+    }
 
-        if (procs == NULL) {
-            fprintf(stderr, "ERROR: Failed to initialize processes\n");
-            return 1;
+    int plen = 0;
+    bool ok = true;
+    for (int i = 3; ok && i < argc; i++) {
+        char* eq = strchr(argv[i], '=');
+        char* at = strchr(argv[i], '@');
+        if (eq != NULL) {
+            int weight;
+            *eq = '\0';
+            ok = parse_int(eq + 1, &weight) && group_add(tree, argv[i], weight) >= 0;
+            *eq = '=';
+        } else {
+            int g = 0;
+            if (at != NULL) {
+                *at = '\0';
+                g = group_find(tree, at + 1);
+                g = (g >= 0) ? g : group_add(tree, at + 1, 1);
+            }
+            ok = g >= 0 && parse_burst(argv[i], &bursts[plen], NULL);
+            groups[plen++] = g;
+            if (at != NULL) {
+                *at = '@';
+            }
         }
+        if (!ok) {
+            print_invalid_arg_error(argv[i]);
+        }
+    }
+    if (ok && plen == 0) {
+        print_missing_args_error();
+        ok = false;
+    }
 
-        printf("Using RR(%d).\n\n", quantum);
+    struct pcb* procs = ok ? init_procs(bursts, plen) : NULL;
+    free(bursts);
+    if (ok && procs == NULL) {
+        fprintf(stderr, "ERROR: Failed to initialize processes\n");
+    }
+    int ngroups = group_count(tree);
+    struct group_stats* stats = malloc(sizeof(struct group_stats) * ngroups);
+    if (procs == NULL || stats == NULL) {
+        group_free(tree);
+        free(groups);
+        free(procs);
+        free(stats);
+        return 1;
+    }
 
-        for (int i = 0; i < plen; i++) {
-            printf("Accepted P%d: Burst %d\n", procs[i].pid, procs[i].burst_left);
+    struct out_buf out;
+    out_init(&out, STDOUT_FILENO, 256 + 64 * (size_t)ngroups + (quiet ? 0 : 80 * (size_t)plen));
+    out_str(&out, "Using group shares (quantum ");
+    out_int(&out, quantum);
+    out_str(&out, ").\n\n");
+    for (int i = 0; !quiet && i < plen; i++) {
+        out_str(&out, "Accepted P");
+        out_int(&out, procs[i].pid);
+        out_str(&out, ": Burst ");
+        out_int(&out, procs[i].burst_left);
+        out_str(&out, " Group ");
+        out_group(&out, tree, groups[i]);
+        out_char(&out, '\n');
+    }
+
+    // Only all-zero bursts take no time at all.
+    bool work = false;
+    for (int i = 0; i < plen; i++) {
+        work = work || procs[i].burst_left > 0;
+    }
+    int total_time = group_run(tree, procs, plen, groups, quantum, stats);
+    ok = total_time > 0 || !work;
+    if (ok) {
+        out_str(&out, "Average wait time: ");
+        out_fixed2(&out, (double)stats[0].wait / plen);
+        out_str(&out, "\nTotal time: ");
+        out_int(&out, total_time);
+        out_str(&out, "\n\n");
+
+        char line[96];
+        snprintf(line, sizeof(line), "%-16s %8s %8s %8s %10s\n", "Group", "Weight", "Procs",
+                 "Share", "Avg wait");
+        out_str(&out, line);
+        for (int g = 0; g < ngroups; g++) {
+            out_group(&out, tree, g);
+            int pad = 15 - (int)strlen(group_path(tree, g));
+            for (int i = 0; i < pad; i++) {
+                out_char(&out, ' ');
+            }
+            double avg = (stats[g].procs > 0) ? (double)stats[g].wait / stats[g].procs : 0.0;
+            snprintf(line, sizeof(line), " %8d %8d %7.2f%% %10.2f\n", group_weight(tree, g),
+                     stats[g].procs, 100.0 * stats[g].share, avg);
+            out_str(&out, line);
+        }
+    }
+    group_free(tree);
+    free(groups);
+    free(procs);
+    free(stats);
+
+    ok = out_flush(&out) && ok;
+    out_free(&out);
+    if (!ok) {
+        fprintf(stderr, "ERROR: Simulation failed\n");
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Run Highest-Response-Ratio-Next over processes with arrival times (see
+ * parta_hrrn.h):
+ *   ./parta_main [--quiet] hrrn <burst1[:arrival1]> <burst2[:arrival2]> ...
+ *
+ * Arrivals default to 0.
+ */
+static int hrrn(int argc, char* argv[], bool quiet) {
+    if (argc < 3) {
+        print_missing_args_error();
+        return 1;
+    }
+
+    int plen = argc - 2;
+    int* bursts = malloc(sizeof(int) * plen);
+    int* arrival = malloc(sizeof(int) * plen);
+    if (bursts == NULL || arrival == NULL) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        free(bursts);
+        free(arrival);
+        return 1;
+    }
+    for (int i = 0; i < plen; i++) {
+        if (!parse_burst(argv[2 + i], &bursts[i], &arrival[i]) || arrival[i] < 0) {
+            print_invalid_arg_error(argv[2 + i]);
+            free(bursts);
+            free(arrival);
+            return 1;
         }
+    }
 
-        int total_time = rr_run(procs, plen, quantum);
-        (void)total_time;
+    struct pcb* procs = init_procs(bursts, plen);
+    free(bursts);
+    if (procs == NULL) {
+        fprintf(stderr, "ERROR: Failed to initialize processes\n");
+        free(arrival);
+        return 1;
+    }
 
-        double sum_wait = 0.0;
-        for (int i = 0; i < plen; i++) {
-            sum_wait += procs[i].wait;
+    struct out_buf out;
+    out_init(&out, STDOUT_FILENO, 256 + (quiet ? 0 : 60 * (size_t)plen));
+    out_str(&out, "Using HRRN.\n\n");
+    for (int i = 0; !quiet && i < plen; i++) {
+        out_str(&out, "Accepted P");
+        out_int(&out, procs[i].pid);
+        out_str(&out, ": Burst ");
+        out_int(&out, procs[i].burst_left);
+        out_str(&out, " Arrival ");
+        out_int(&out, arrival[i]);
+        out_char(&out, '\n');
+    }
+
+    int total_time = hrrn_run(procs, plen, arrival, NULL);
+    long long sum_wait = 0;
+    for (int i = 0; i < plen; i++) {
+        sum_wait += procs[i].wait;
+    }
+    out_str(&out, "Average wait time: ");
+    out_fixed2(&out, (double)sum_wait / plen);
+    out_str(&out, "\nTotal time: ");
+    out_int(&out, total_time);
+    out_char(&out, '\n');
+    free(procs);
+    free(arrival);
+
+    bool ok = out_flush(&out);
+    out_free(&out);
+    return ok ? 0 : 1;
+}
+
+/**
+ * Command-line driver for the CPU scheduler.
+ *
+ * Usage:
+ *   ./parta_main [--quiet] fcfs <burst1> <burst2> ...
+ *   ./parta_main fcfs --stream [file|-] [--out file|-]
+ *   ./parta_main rr-ooc <quantum> [file|-] [--out file|-] [--mem MB] [--tmp dir]
+ *   ./parta_main [--quiet] sjf <burst1> <burst2> ...
+ *   ./parta_main [--quiet] rr <quantum> <burst1> <burst2> ...
+ *   ./parta_main [--quiet] rr-opt <mean|p99|switch:dispatch> <burst1> <burst2> ...
+ *   ./parta_main mc <algo[:param]> <dist> <procs> [--runs N] [--ci W] [--threads T] [--seed S]
+ *   ./parta_main [--quiet] smp <cpus> <quantum> <latency> [--threads T] <burst1> ...
+ *   ./parta_main [--quiet] group <quantum> <path=weight | burst[@path]> ...
+ *   ./parta_main [--quiet] prio <aging> <burst1[:prio1]> <burst2[:prio2]> ...
+ *   ./parta_main [--quiet] prio-p <aging> <burst1[:prio1]> <burst2[:prio2]> ...
+ *   ./parta_main [--quiet] eevdf <slice> <burst1[:prio1]> <burst2[:prio2]> ...
+ *   ./parta_main [--quiet] hrrn <burst1[:arrival1]> <burst2[:arrival2]> ...
+ *   ./parta_main [--quiet] compare <algo[:param]> ... <burst1[:prio1]> ...
+ *   ./parta_main serve <socket> [threads] [cache_mb]
+ *
+ * On success, prints:
+ *   - The algorithm used
+ *   - List of accepted processes and bursts (skipped with --quiet)
+ *   - Average wait time (2 decimal places), or for compare a table of average
+ *     and 99th percentile wait and total time per algorithm
+ *
+ * Every algorithm goes through the same parse -> init -> run -> report
+ * pipeline; the algorithms themselves are described in parta_algo.c.
+ * Output is built in one buffer and written with a single write(2).
+ *
+ * On incorrect/missing arguments, prints an error and exits with status 1.
+ */
+int main(int argc, char* argv[]) {
+    // --quiet (or -q) may appear anywhere; drop it before positional parsing.
+    bool quiet = false;
+    int kept = 1;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quiet") == 0 || strcmp(argv[i], "-q") == 0) {
+            quiet = true;
+        } else {
+            argv[kept++] = argv[i];
         }
-        double avg_wait = (plen > 0) ? (sum_wait / plen) : 0.0;
+    }
+    argc = kept;
 
-        printf("Average wait time: %.2f\n", avg_wait);
+    if (argc < 2) {
+        print_missing_args_error();
+        return 1;
+    }
 
-        free(procs);
-        return 0;
+    if (strcmp(argv[1], "serve") == 0) {
+        return serve(argc, argv);
+    }
+    if (strcmp(argv[1], "fcfs") == 0 && argc > 2 && strcmp(argv[2], "--stream") == 0) {
+        return stream_fcfs(argc, argv);
+    }
+    if (strcmp(argv[1], "rr-ooc") == 0) {
+        return ooc_rr(argc, argv);
+    }
+    if (strcmp(argv[1], "rr-opt") == 0) {
+        return optimize_rr(argc, argv, quiet);
+    }
+    if (strcmp(argv[1], "mc") == 0) {
+        return monte_carlo(argc, argv);
+    }
+    if (strcmp(argv[1], "smp") == 0) {
+        return smp(argc, argv, quiet);
+    }
+    if (strcmp(argv[1], "group") == 0) {
+        return group(argc, argv, quiet);
+    }
+    if (strcmp(argv[1], "hrrn") == 0) {
+        return hrrn(argc, argv, quiet);
+    }
 
+    // Parse: which algorithms to run and where the bursts start.
+    struct sched_spec specs[MAX_SPECS];
+    bool compare = (strcmp(argv[1], "compare") == 0);
+    int nspecs = 1;
+    int first;
+    if (compare) {
+        nspecs = parse_compare(argc, argv, specs);
+        first = 2 + nspecs;
     } else {
-        // Unknown algorithm – treat as incorrect usage.
+        int used = parse_single(argc, argv, &specs[0]);
+        if (used == 0) {
+            return 1;
+        }
+        first = 1 + used;
+    }
+    if (nspecs == 0) {
+        return 1;
+    }
+
+    // Need at least one burst.
+    if (first >= argc) {
         print_missing_args_error();
         return 1;
     }
+
+    // Init: one PCB array shared (read-only) by every algorithm. Compare
+    // always accepts burst:prio; the echo shows priorities if any spec uses them.
+    bool show_priority = false;
+    for (int i = 0; i < nspecs; i++) {
+        show_priority = show_priority || (specs[i].algo->flags & SCHED_PRIORITY);
+    }
+    bool with_priority = compare || show_priority;
+    int plen = argc - first;
+    struct pcb* procs = parse_procs(&argv[first], plen, with_priority);
+    if (procs == NULL) {
+        return 1;
+    }
+
+    struct out_buf out;
+    out_init(&out, STDOUT_FILENO, 128 + 64 * (size_t)nspecs + (quiet ? 0 : 60 * (size_t)plen));
+
+    char label[32];
+    if (compare) {
+        out_str(&out, "Comparing ");
+        for (int i = 0; i < nspecs; i++) {
+            sched_label(&specs[i], label, sizeof(label));
+            out_str(&out, (i > 0) ? ", " : "");
+            out_str(&out, label);
+        }
+        out_str(&out, "\n\n");
+    } else {
+        sched_label(&specs[0], label, sizeof(label));
+        out_str(&out, "Using ");
+        out_str(&out, label);
+        out_str(&out, (specs[0].algo->flags & SCHED_PARAM) ? ".\n\n" : "\n\n");
+    }
+    if (!quiet) {
+        echo_procs(&out, procs, plen, show_priority);
+        out_str(&out, compare ? "\n" : "");
+    }
+
+    // Run and report. A failed run is reported on its own; nothing of
+    // its output is written.
+    bool ran;
+    if (compare) {
+        ran = report_compare(&out, specs, nspecs, procs, plen);
+    } else {
+        // With $PARTA_CACHE_DIR set, repeated runs are answered from disk.
+        const char* cache_dir = getenv("PARTA_CACHE_DIR");
+        struct result_cache* cache = (cache_dir != NULL) ? cache_create((size_t)1 << 20, cache_dir)
+                                                         : NULL;
+        struct sched_result result;
+        ran = cache_sched_run(cache, &specs[0], procs, plen, procs, &result);
+        cache_free(cache);
+        if (ran) {
+            out_str(&out, "Average wait time: ");
+            out_fixed2(&out, result.avg_wait);
+            out_char(&out, '\n');
+        } else {
+            fprintf(stderr, "ERROR: Simulation failed\n");
+        }
+    }
+    free(procs);
+
+    bool written = ran && out_flush(&out);
+    out_free(&out);
+    if (!ran) {
+        return 1;
+    }
+    if (!written) {
+        fprintf(stderr, "ERROR: Failed to write output\n");
+        return 1;
+    }
+    return 0;
 }
@@ -0,0 +1,287 @@
+#include "parta_mc.h"
+#include "parta_cli.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/** SplitMix64 finalizer: a bijective mix of all 64 bits. */
+static unsigned long long mix64(unsigned long long z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static unsigned long long next_u64(unsigned long long* state) {
+    *state += 0x9E3779B97F4A7C15ull;
+    return mix64(*state);
+}
+
+/** Uniform in [0, range) by multiply-shift. */
+static unsigned long long next_below(unsigned long long* state, unsigned long long range) {
+    return (unsigned long long)(((unsigned __int128)next_u64(state) * range) >> 64);
+}
+
+/**
+ * Parse "uniform:lo:hi" or "bimodal:short:long:pct" with
+ * 1 <= lo <= hi (short <= long) and 0 <= pct <= 100.
+ *
+ * Returns true and fills *dist on success.
+ */
+bool mc_parse_dist(const char* text, struct mc_dist* dist) {
+    char buf[64];
+    if (text == NULL || dist == NULL || strlen(text) >= sizeof(buf)) {
+        return false;
+    }
+    strcpy(buf, text);
+
+    char* fields[5];
+    int nfields = 0;
+    for (char* p = buf; nfields < 5; nfields++) {
+        fields[nfields] = p;
+        p = strchr(p, ':');
+        if (p == NULL) {
+            nfields++;
+            break;
+        }
+        *p++ = '\0';
+    }
+
+    int values[3] = { 0, 0, 0 };
+    for (int i = 1; i < nfields && i <= 3; i++) {
+        if (!parse_int(fields[i], &values[i - 1])) {
+            return false;
+        }
+    }
+    *dist = (struct mc_dist){ MC_UNIFORM, values[0], values[1], values[2] };
+    if (strcmp(fields[0], "uniform") == 0 && nfields == 3) {
+        dist->pct = 0;
+    } else if (strcmp(fields[0], "bimodal") == 0 && nfields == 4) {
+        dist->kind = MC_BIMODAL;
+    } else {
+        return false;
+    }
+    return dist->lo >= 1 && dist->lo <= dist->hi && dist->pct >= 0 && dist->pct <= 100;
+}
+
+/**
+ * Draw the bursts of workload `index`. Its PRNG stream starts at a
+ * hashed offset of (seed, index) on the SplitMix64 sequence, so the
+ * streams of different workloads do not overlap in practice and the
+ * bursts do not depend on which thread draws them.
+ */
+void mc_workload(const struct mc_dist* dist, unsigned long long seed, long long index,
+                 int* bursts, int plen) {
+    unsigned long long state = mix64(mix64(seed) + (unsigned long long)index);
+    unsigned long long span = (unsigned long long)dist->hi - (unsigned long long)dist->lo + 1;
+    for (int i = 0; i < plen; i++) {
+        if (dist->kind == MC_BIMODAL) {
+            bursts[i] = ((int)next_below(&state, 100) < dist->pct) ? dist->hi : dist->lo;
+        } else {
+            bursts[i] = dist->lo + (int)next_below(&state, span);
+        }
+    }
+}
+
+struct mc_pool;
+
+/** One thread's share of the work and everything it has aggregated */
+struct mc_worker {
+    struct mc_pool* pool;
+    int id;
+    int* bursts;
+    struct pcb* procs;
+    bool error;
+    struct welford avg_wait;
+    struct welford p99_wait;
+    struct welford total;
+    struct wait_sketch waits;
+};
+
+/**
+ * Batch hand-off between mc_run and the worker threads. Only the batch
+ * bounds go through the lock; the statistics stay in each mc_worker
+ * until mc_run merges them after the batch.
+ */
+struct mc_pool {
+    const struct mc_config* config;
+    struct mc_worker* workers;
+    int nworkers;
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    long long generation; /* Bumped for every batch */
+    long long begin;      /* Workloads of the current batch */
+    long long end;
+    int pending;          /* Threads still running the batch */
+    bool stop;
+};
+
+static void run_batch(struct mc_worker* w, long long begin, long long end) {
+    const struct mc_config* config = w->pool->config;
+    for (long long i = begin + w->id; i < end && !w->error; i += w->pool->nworkers) {
+        mc_workload(&config->dist, config->seed, i, w->bursts, config->plen);
+        for (int j = 0; j < config->plen; j++) {
+            w->procs[j] = (struct pcb){ j, w->bursts[j], 0, 0 };
+        }
+        struct sched_result r;
+        if (!sched_run(&config->spec, w->procs, config->plen, w->procs, &r)) {
+            w->error = true;
+            break;
+        }
+        welford_add(&w->avg_wait, r.avg_wait);
+        welford_add(&w->p99_wait, r.p99_wait);
+        welford_add(&w->total, r.total_time);
+        for (int j = 0; j < config->plen; j++) {
+            sketch_add(&w->waits, w->procs[j].wait);
+        }
+    }
+}
+
+static void* mc_thread(void* arg) {
+    struct mc_worker* w = arg;
+    struct mc_pool* pool = w->pool;
+    long long seen = 0;
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->generation == seen && !pool->stop) {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if (pool->stop) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        seen = pool->generation;
+        long long begin = pool->begin;
+        long long end = pool->end;
+        pthread_mutex_unlock(&pool->lock);
+
+        run_batch(w, begin, end);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) {
+            pthread_cond_signal(&pool->done);
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+/**
+ * Run config->spec over random workloads until max_runs have run or the
+ * 95% confidence interval of the mean wait is within ci_target (checked
+ * after every batch of MC_BATCH, from MC_MIN_RUNS on). The calling
+ * thread is worker 0.
+ *
+ * For a given thread count the result is reproducible; other counts
+ * run the same workloads but merge the means in another order.
+ *
+ * Returns true on success.
+ */
+bool mc_run(const struct mc_config* config, struct mc_result* result) {
+    if (config == NULL || result == NULL || config->spec.algo == NULL || config->plen <= 0 ||
+        config->max_runs <= 0) {
+        return false;
+    }
+
+    int threads = config->threads;
+    if (threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 0) ? (int)cpus : 1;
+    }
+    threads = (threads < MC_BATCH) ? threads : MC_BATCH;
+
+    struct mc_pool pool = { 0 };
+    pool.config = config;
+    pool.workers = calloc(threads, sizeof(struct mc_worker));
+    pthread_t* tids = malloc(sizeof(pthread_t) * threads);
+    bool ok = pool.workers != NULL && tids != NULL;
+    for (int t = 0; ok && t < threads; t++) {
+        struct mc_worker* w = &pool.workers[t];
+        w->pool = &pool;
+        w->id = t;
+        w->bursts = malloc(sizeof(int) * config->plen);
+        w->procs = malloc(sizeof(struct pcb) * config->plen);
+        ok = w->bursts != NULL && w->procs != NULL;
+        welford_init(&w->avg_wait);
+        welford_init(&w->p99_wait);
+        welford_init(&w->total);
+        sketch_init(&w->waits);
+    }
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.start, NULL);
+    pthread_cond_init(&pool.done, NULL);
+
+    // If a thread cannot be started, the batches are split among fewer.
+    int started = 0;
+    for (int t = 1; ok && t < threads; t++) {
+        if (pthread_create(&tids[started], NULL, mc_thread, &pool.workers[started + 1]) != 0) {
+            break;
+        }
+        started++;
+    }
+    pool.nworkers = started + 1;
+
+    long long runs = 0;
+    bool converged = false;
+    while (ok && runs < config->max_runs && !converged) {
+        pthread_mutex_lock(&pool.lock);
+        pool.begin = runs;
+        pool.end = (config->max_runs - runs > MC_BATCH) ? runs + MC_BATCH : config->max_runs;
+        pool.pending = started;
+        pool.generation++;
+        pthread_cond_broadcast(&pool.start);
+        pthread_mutex_unlock(&pool.lock);
+
+        run_batch(&pool.workers[0], pool.begin, pool.end);
+
+        pthread_mutex_lock(&pool.lock);
+        while (pool.pending > 0) {
+            pthread_cond_wait(&pool.done, &pool.lock);
+        }
+        pthread_mutex_unlock(&pool.lock);
+        runs = pool.end;
+
+        struct welford avg;
+        welford_init(&avg);
+        for (int t = 0; t < pool.nworkers; t++) {
+            ok = ok && !pool.workers[t].error;
+            welford_merge(&avg, &pool.workers[t].avg_wait);
+        }
+        converged = config->ci_target > 0.0 && runs >= MC_MIN_RUNS &&
+                    welford_ci95(&avg) <= config->ci_target;
+    }
+
+    pthread_mutex_lock(&pool.lock);
+    pool.stop = true;
+    pthread_cond_broadcast(&pool.start);
+    pthread_mutex_unlock(&pool.lock);
+    for (int t = 0; t < started; t++) {
+        pthread_join(tids[t], NULL);
+    }
+
+    if (ok) {
+        result->runs = runs;
+        result->converged = converged;
+        welford_init(&result->avg_wait);
+        welford_init(&result->p99_wait);
+        welford_init(&result->total);
+        sketch_init(&result->waits);
+        for (int t = 0; t < pool.nworkers; t++) {
+            welford_merge(&result->avg_wait, &pool.workers[t].avg_wait);
+            welford_merge(&result->p99_wait, &pool.workers[t].p99_wait);
+            welford_merge(&result->total, &pool.workers[t].total);
+            sketch_merge(&result->waits, &pool.workers[t].waits);
+        }
+    }
+
+    for (int t = 0; pool.workers != NULL && t < threads; t++) {
+        free(pool.workers[t].bursts);
+        free(pool.workers[t].procs);
+    }
+    pthread_cond_destroy(&pool.done);
+    pthread_cond_destroy(&pool.start);
+    pthread_mutex_destroy(&pool.lock);
+    free(pool.workers);
+    free(tids);
+    return ok;
+}
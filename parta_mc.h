@@ -0,0 +1,61 @@
+#pragma once
+
+#include "parta_algo.h"
+#include "parta_sketch.h"
+
+/**
+ * Monte Carlo evaluation of a scheduler over random workloads. Workload
+ * i draws its bursts from its own PRNG stream, seeded from (seed, i), so
+ * it is the same whichever thread runs it and however many run.
+ *
+ * Workloads run in batches of MC_BATCH on a pool of threads: thread t
+ * takes the workloads of the batch with i % threads == t and keeps its
+ * own Welford summaries and wait sketch, so nothing is shared while a
+ * batch runs. Between batches the per-thread summaries are merged and
+ * the run stops once the 95% confidence interval of the mean wait is
+ * narrow enough.
+ */
+#define MC_BATCH 256
+
+/** Fewest workloads before the confidence interval may stop a run */
+#define MC_MIN_RUNS 30
+
+/** Burst distributions */
+enum mc_dist_kind {
+    MC_UNIFORM, /** "uniform:lo:hi", every burst in [lo, hi] equally likely */
+    MC_BIMODAL, /** "bimodal:short:long:pct", long with pct% probability */
+};
+
+struct mc_dist {
+    enum mc_dist_kind kind;
+    int lo;  /** Smallest (uniform) or short (bimodal) burst */
+    int hi;  /** Largest (uniform) or long (bimodal) burst */
+    int pct; /** Percent of long bursts (bimodal) */
+};
+
+/** Settings of mc_run */
+struct mc_config {
+    struct sched_spec spec;
+    struct mc_dist dist;
+    int plen;                /** Processes per workload */
+    long long max_runs;      /** Most workloads to run */
+    double ci_target;        /** Stop once the 95% CI half-width of the mean wait is at most this; <= 0 never */
+    int threads;             /** Worker threads, <= 0 for one per CPU */
+    unsigned long long seed;
+};
+
+/** Aggregated outcome of mc_run */
+struct mc_result {
+    long long runs;          /** Workloads run */
+    bool converged;          /** Stopped because the CI target was met */
+    struct welford avg_wait; /** Over workloads, of each one's mean wait */
+    struct welford p99_wait; /** Over workloads, of each one's p99 wait */
+    struct welford total;    /** Over workloads, of each one's total time */
+    struct wait_sketch waits; /** Every process' wait in every workload */
+};
+
+
+bool mc_parse_dist(const char* text, struct mc_dist* dist);
+void mc_workload(const struct mc_dist* dist, unsigned long long seed, long long index,
+                 int* bursts, int plen);
+bool mc_run(const struct mc_config* config, struct mc_result* result);
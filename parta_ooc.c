@@ -0,0 +1,551 @@
+#include "parta_ooc.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <unistd.h>
+
+/** stdio buffer of every spill file; also the unit of the merge fan-in */
+#define OOC_IO_BUF (1 << 16)
+
+/** Smallest budget accepted (smaller ones are raised to it) */
+#define OOC_MIN_MEM (1 << 16)
+
+/** Bursts read per fread during a band scan */
+#define OOC_SCAN_BLOCK 4096
+
+/** Processes that need `c` rounds: how many and their total burst */
+struct ooc_level {
+    long long c;
+    long long count;
+    long long sum;
+};
+
+/** One computed wait, spilled when there is more than one band */
+struct ooc_wait {
+    long long pid;
+    long long wait;
+};
+
+/** Consumer of merged records; returns false to stop with an error */
+typedef bool (*ooc_sink)(void* ctx, const void* rec);
+
+/**
+ * Create an anonymous spill file under dir: it is unlinked right away,
+ * so it disappears when closed, even if the run fails.
+ */
+static FILE* spill_open(const char* dir) {
+    char path[PATH_MAX];
+    snprintf(path, sizeof(path), "%s/parta_ooc_XXXXXX", dir);
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        return NULL;
+    }
+    unlink(path);
+    FILE* f = fdopen(fd, "w+b");
+    if (f == NULL) {
+        close(fd);
+        return NULL;
+    }
+    setvbuf(f, NULL, _IOFBF, OOC_IO_BUF);
+    return f;
+}
+
+static void spill_close_all(FILE** files, int n) {
+    for (int i = 0; i < n; i++) {
+        if (files[i] != NULL) {
+            fclose(files[i]);
+        }
+    }
+}
+
+/** Merge key: the burst of an int record, the pid of an ooc_wait. */
+static long long rec_key(const char* rec, size_t size) {
+    if (size == sizeof(int)) {
+        int v;
+        memcpy(&v, rec, sizeof(v));
+        return v;
+    }
+    long long k;
+    memcpy(&k, rec, sizeof(k));
+    return k;
+}
+
+static bool heap_less(const long long* keys, int a, int b) {
+    return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+}
+
+static void heap_down(int* heap, int n, const long long* keys, int pos) {
+    for (;;) {
+        int min = pos;
+        int l = 2 * pos + 1;
+        int r = l + 1;
+        if (l < n && heap_less(keys, heap[l], heap[min])) {
+            min = l;
+        }
+        if (r < n && heap_less(keys, heap[r], heap[min])) {
+            min = r;
+        }
+        if (min == pos) {
+            return;
+        }
+        int t = heap[pos];
+        heap[pos] = heap[min];
+        heap[min] = t;
+        pos = min;
+    }
+}
+
+/**
+ * k-way merge of sorted files of `size`-byte records into `sink`, with a
+ * binary min-heap of the current head of each file.
+ *
+ * Returns false if a read failed, memory ran out or the sink failed.
+ */
+static bool merge_files(FILE** in, int k, size_t size, ooc_sink sink, void* ctx) {
+    char* recs = malloc(size * k);
+    long long* keys = malloc(sizeof(long long) * k);
+    int* heap = malloc(sizeof(int) * k);
+    bool ok = (recs != NULL && keys != NULL && heap != NULL);
+
+    int n = 0;
+    for (int i = 0; ok && i < k; i++) {
+        rewind(in[i]);
+        if (fread(recs + size * i, size, 1, in[i]) == 1) {
+            keys[i] = rec_key(recs + size * i, size);
+            heap[n++] = i;
+        }
+    }
+    for (int i = n / 2 - 1; i >= 0; i--) {
+        heap_down(heap, n, keys, i);
+    }
+
+    while (ok && n > 0) {
+        int top = heap[0];
+        ok = sink(ctx, recs + size * top);
+        if (fread(recs + size * top, size, 1, in[top]) == 1) {
+            keys[top] = rec_key(recs + size * top, size);
+        } else {
+            heap[0] = heap[--n];
+        }
+        heap_down(heap, n, keys, 0);
+    }
+
+    for (int i = 0; i < k; i++) {
+        ok = ok && !ferror(in[i]);
+    }
+    free(recs);
+    free(keys);
+    free(heap);
+    return ok;
+}
+
+/** Sink that appends records to a spill file (ctx is a struct ooc_spill) */
+struct ooc_spill {
+    FILE* f;
+    size_t size;
+};
+
+static bool sink_spill(void* ctx, const void* rec) {
+    struct ooc_spill* s = ctx;
+    return fwrite(rec, s->size, 1, s->f) == 1;
+}
+
+/**
+ * Merge groups of `fan_in` files into one until at most fan_in remain,
+ * so the final merge keeps one buffer per file within the budget.
+ *
+ * Returns false on failure (every file is closed then).
+ */
+static bool reduce_files(FILE** files, int* n, int fan_in, size_t size, const char* dir) {
+    while (*n > fan_in) {
+        struct ooc_spill out = { spill_open(dir), size };
+        if (out.f == NULL || !merge_files(files, fan_in, size, sink_spill, &out) ||
+            fflush(out.f) != 0) {
+            if (out.f != NULL) {
+                fclose(out.f);
+            }
+            spill_close_all(files, *n);
+            *n = 0;
+            return false;
+        }
+        spill_close_all(files, fan_in);
+        memmove(files, files + fan_in, sizeof(FILE*) * (*n - fan_in));
+        *n -= fan_in;
+        files[(*n)++] = out.f;
+    }
+    return true;
+}
+
+/** Files spilled by one run */
+struct ooc_files {
+    FILE** list;
+    int n;
+    int cap;
+};
+
+static bool files_push(struct ooc_files* files, FILE* f) {
+    if (files->n == files->cap) {
+        int cap = (files->cap > 0) ? files->cap * 2 : 16;
+        FILE** list = realloc(files->list, sizeof(FILE*) * cap);
+        if (list == NULL) {
+            return false;
+        }
+        files->list = list;
+        files->cap = cap;
+    }
+    files->list[files->n++] = f;
+    return true;
+}
+
+static void files_free(struct ooc_files* files) {
+    spill_close_all(files->list, files->n);
+    free(files->list);
+    files->list = NULL;
+    files->n = 0;
+}
+
+static int cmp_int(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+/** Sort run[0..len) and spill it as a new run. */
+static bool spill_run(int* run, size_t len, const char* dir, struct ooc_files* runs) {
+    qsort(run, len, sizeof(int), cmp_int);
+    FILE* f = spill_open(dir);
+    if (f == NULL) {
+        return false;
+    }
+    if (fwrite(run, sizeof(int), len, f) != len || fflush(f) != 0 || !files_push(runs, f)) {
+        fclose(f);
+        return false;
+    }
+    return true;
+}
+
+/** Sink that groups sorted bursts into levels */
+struct ooc_leveler {
+    FILE* f;
+    long long q;
+    struct ooc_level cur;
+    long long nlevels;
+};
+
+static bool leveler_flush(struct ooc_leveler* lv) {
+    if (lv->cur.count == 0) {
+        return true;
+    }
+    lv->nlevels++;
+    return fwrite(&lv->cur, sizeof(lv->cur), 1, lv->f) == 1;
+}
+
+static bool sink_level(void* ctx, const void* rec) {
+    struct ooc_leveler* lv = ctx;
+    int b;
+    memcpy(&b, rec, sizeof(b));
+    long long c = (b + lv->q - 1) / lv->q;
+    if (c != lv->cur.c) {
+        if (!leveler_flush(lv)) {
+            return false;
+        }
+        lv->cur = (struct ooc_level){ c, 0, 0 };
+    }
+    lv->cur.count++;
+    lv->cur.sum += b;
+    return true;
+}
+
+/** Sink that receives waits in pid order: summary and optional output */
+struct ooc_output {
+    struct out_buf* out;
+    struct wait_sketch* sketch;
+    unsigned __int128 sum_wait;
+    bool write_failed;
+};
+
+static bool sink_output(void* ctx, const void* rec) {
+    struct ooc_output* o = ctx;
+    struct ooc_wait w;
+    memcpy(&w, rec, sizeof(w));
+    o->sum_wait += (unsigned long long)w.wait;
+    sketch_add(o->sketch, w.wait);
+    if (o->out != NULL && !stream_write_wait(o->out, w.pid, w.wait)) {
+        o->write_failed = true;
+        return false;
+    }
+    return true;
+}
+
+/** Per-level state of the band being scanned */
+struct ooc_band {
+    int n;
+    long long lo;       /* Smallest level of the band */
+    long long hi;       /* Largest level of the band */
+    long long* c;       /* Levels, ascending */
+    long long* base;    /* Wait from everyone's first c - 1 rounds */
+    long long* fenwick; /* Earlier processes per level, 1-based */
+    long long* last;    /* Sum of last slices of earlier processes per level */
+};
+
+/**
+ * Load the next band of up to `cap` levels. *below_sum and *below_count
+ * carry the bursts of all lower levels from band to band.
+ */
+static bool band_load(struct ooc_band* band, FILE* levels, int cap, long long q,
+                      long long present, long long* below_sum, long long* below_count) {
+    band->n = 0;
+    struct ooc_level lv;
+    while (band->n < cap && fread(&lv, sizeof(lv), 1, levels) == 1) {
+        // Everyone else runs min(b, L) before i's last round, L = q(c - 1).
+        long long cap_l = q * (lv.c - 1);
+        band->c[band->n] = lv.c;
+        band->base[band->n] = *below_sum + cap_l * (present - *below_count) - cap_l;
+        band->last[band->n] = 0;
+        band->n++;
+        *below_sum += lv.sum;
+        *below_count += lv.count;
+    }
+    memset(band->fenwick, 0, sizeof(long long) * (band->n + 1));
+    if (band->n > 0) {
+        band->lo = band->c[0];
+        band->hi = band->c[band->n - 1];
+    }
+    return !ferror(levels);
+}
+
+static int band_find(const struct ooc_band* band, long long c) {
+    int lo = 0;
+    int hi = band->n - 1;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (band->c[mid] < c) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * Scan every burst in pid order and compute the wait of each process
+ * whose level is in the band (and, for the first band, of each absent
+ * process), passing (pid, wait) to `sink`.
+ */
+static bool band_scan(struct ooc_band* band, FILE* bursts, long long q, bool first,
+                      ooc_sink sink, void* ctx) {
+    int block[OOC_SCAN_BLOCK];
+    long long pid = 0;
+    long long seen = 0;  /* Earlier present processes */
+    long long below = 0; /* Earlier present processes below the band */
+
+    rewind(bursts);
+    size_t got;
+    while ((got = fread(block, sizeof(int), OOC_SCAN_BLOCK, bursts)) > 0) {
+        for (size_t k = 0; k < got; k++, pid++) {
+            int b = block[k];
+            if (b <= 0) {
+                struct ooc_wait w = { pid, 0 };
+                if (first && !sink(ctx, &w)) {
+                    return false;
+                }
+                continue;
+            }
+
+            long long c = (b + q - 1) / q;
+            if (c < band->lo) {
+                below++;
+            } else if (c <= band->hi) {
+                int lvl = band_find(band, c);
+                long long not_above = below;
+                for (int i = lvl + 1; i > 0; i -= i & -i) {
+                    not_above += band->fenwick[i];
+                }
+                // Earlier processes also get round c: q if they need more
+                // rounds, their last slice if they need exactly c.
+                struct ooc_wait w = { pid, band->base[lvl] + q * (seen - not_above) + band->last[lvl] };
+                if (!sink(ctx, &w)) {
+                    return false;
+                }
+                for (int i = lvl + 1; i <= band->n; i += i & -i) {
+                    band->fenwick[i]++;
+                }
+                band->last[lvl] += b - q * (c - 1);
+            }
+            seen++;
+        }
+    }
+    return !ferror(bursts);
+}
+
+/**
+ * Run Round-Robin over the bursts read from in_fd (the text format of
+ * fcfs_stream_fd) using at most about config->mem_bytes of memory plus
+ * spill files under config->tmp_dir:
+ *
+ *   1. Read the bursts once, spilling them in pid order and as sorted
+ *      runs of up to mem_bytes.
+ *   2. Merge the runs (several passes if there are more than fit in the
+ *      budget) into the table of levels.
+ *   3. For each band of levels that fits the budget, scan the bursts in
+ *      pid order to compute the waits of that band.
+ *   4. With several bands, merge their (pid, wait) files by pid.
+ *
+ * Waits reach `out` (may be NULL) as "<pid> <wait>" lines in pid order
+ * and are summarized in *result.
+ *
+ * Returns STREAM_OK or why the run failed.
+ */
+enum stream_status rr_ooc_run(int in_fd, int quantum, const struct ooc_config* config,
+                              struct out_buf* out, struct ooc_result* result) {
+    if (quantum <= 0 || config == NULL || result == NULL) {
+        return STREAM_EINPUT;
+    }
+    const char* dir = config->tmp_dir;
+    dir = (dir != NULL) ? dir : getenv("TMPDIR");
+    dir = (dir != NULL) ? dir : "/tmp";
+    size_t mem = (config->mem_bytes > OOC_MIN_MEM) ? config->mem_bytes : OOC_MIN_MEM;
+    int fan_in = (int)(mem / OOC_IO_BUF) - 2;
+    fan_in = (fan_in > 2) ? ((fan_in < 4096) ? fan_in : 4096) : 2;
+    long long q = quantum;
+
+    memset(result, 0, sizeof(*result));
+    struct ooc_files runs = { NULL, 0, 0 };
+    struct ooc_files bands = { NULL, 0, 0 };
+    FILE* bursts = spill_open(dir);
+    FILE* levels = spill_open(dir);
+    struct wait_sketch* sketch = malloc(sizeof(struct wait_sketch));
+    size_t run_cap = mem / sizeof(int);
+    int* run = malloc(sizeof(int) * run_cap);
+    struct burst_reader reader = { 0 };
+    enum stream_status status = STREAM_OK;
+    if (sketch == NULL || run == NULL || !burst_reader_init(&reader, in_fd)) {
+        status = STREAM_ENOMEM;
+    } else if (bursts == NULL || levels == NULL) {
+        status = STREAM_ETMP;
+    }
+
+    // 1. Spill the bursts in pid order and as sorted runs.
+    long long plen = 0;
+    long long present = 0;
+    long long total = 0;
+    size_t len = 0;
+    int b;
+    while (status == STREAM_OK && burst_reader_next(&reader, &b)) {
+        if (fwrite(&b, sizeof(int), 1, bursts) != 1) {
+            status = STREAM_ETMP;
+            break;
+        }
+        plen++;
+        if (b > 0) {
+            present++;
+            total += b;
+            run[len++] = b;
+            if (len == run_cap) {
+                status = spill_run(run, len, dir, &runs) ? STREAM_OK : STREAM_ETMP;
+                len = 0;
+            }
+        }
+    }
+    status = (status == STREAM_OK) ? reader.status : status;
+    if (status == STREAM_OK && len > 0 && !spill_run(run, len, dir, &runs)) {
+        status = STREAM_ETMP;
+    }
+    free(run);
+    burst_reader_free(&reader);
+    result->plen = (status == STREAM_EINPUT) ? reader.count : plen;
+    result->runs = runs.n;
+
+    // 2. Sorted bursts -> levels.
+    struct ooc_leveler lv = { levels, q, { 0, 0, 0 }, 0 };
+    if (status == STREAM_OK &&
+        (fflush(bursts) != 0 || !reduce_files(runs.list, &runs.n, fan_in, sizeof(int), dir) ||
+         !merge_files(runs.list, runs.n, sizeof(int), sink_level, &lv) || !leveler_flush(&lv) ||
+         fflush(levels) != 0)) {
+        status = STREAM_ETMP;
+    }
+    files_free(&runs);
+
+    // 3. One pid-order scan per band of levels.
+    size_t level_cap = mem / (4 * sizeof(long long));
+    level_cap = (level_cap < (size_t)lv.nlevels) ? level_cap : (size_t)lv.nlevels;
+    level_cap = (level_cap < INT_MAX / 2) ? level_cap : INT_MAX / 2;
+    int band_cap = (level_cap > 0) ? (int)level_cap : 1;
+    struct ooc_band band = { 0 };
+    band.c = malloc(sizeof(long long) * band_cap);
+    band.base = malloc(sizeof(long long) * band_cap);
+    band.fenwick = malloc(sizeof(long long) * (band_cap + 1));
+    band.last = malloc(sizeof(long long) * band_cap);
+    if (status == STREAM_OK &&
+        (band.c == NULL || band.base == NULL || band.fenwick == NULL || band.last == NULL)) {
+        status = STREAM_ENOMEM;
+    }
+
+    struct ooc_output output = { out, sketch, 0, false };
+    if (sketch != NULL) {
+        sketch_init(sketch);
+    }
+    long long nbands = (lv.nlevels + band_cap - 1) / band_cap;
+    nbands = (nbands > 0) ? nbands : 1;
+    result->bands = (int)nbands;
+    long long below_sum = 0;
+    long long below_count = 0;
+    if (status == STREAM_OK) {
+        rewind(levels);
+    }
+    for (long long i = 0; status == STREAM_OK && i < nbands; i++) {
+        if (!band_load(&band, levels, band_cap, q, present, &below_sum, &below_count)) {
+            status = STREAM_ETMP;
+            break;
+        }
+        if (nbands == 1) {
+            if (!band_scan(&band, bursts, q, true, sink_output, &output)) {
+                status = output.write_failed ? STREAM_EWRITE : STREAM_ETMP;
+            }
+            continue;
+        }
+        struct ooc_spill spill = { spill_open(dir), sizeof(struct ooc_wait) };
+        if (spill.f != NULL && !files_push(&bands, spill.f)) {
+            fclose(spill.f);
+            spill.f = NULL;
+        }
+        if (spill.f == NULL || !band_scan(&band, bursts, q, i == 0, sink_spill, &spill) ||
+            fflush(spill.f) != 0) {
+            status = STREAM_ETMP;
+        }
+    }
+    free(band.c);
+    free(band.base);
+    free(band.fenwick);
+    free(band.last);
+
+    // 4. Bands -> pid order.
+    if (status == STREAM_OK && nbands > 1) {
+        if (!reduce_files(bands.list, &bands.n, fan_in, sizeof(struct ooc_wait), dir) ||
+            !merge_files(bands.list, bands.n, sizeof(struct ooc_wait), sink_output, &output)) {
+            status = output.write_failed ? STREAM_EWRITE : STREAM_ETMP;
+        }
+    }
+    files_free(&bands);
+    if (status == STREAM_OK && out != NULL && !out_flush(out)) {
+        status = STREAM_EWRITE;
+    }
+
+    if (status == STREAM_OK) {
+        result->total_time = total;
+        result->avg_wait = (plen > 0) ? (double)output.sum_wait / (double)plen : 0.0;
+        result->p50_wait = sketch_quantile(sketch, 0.50);
+        result->p99_wait = sketch_quantile(sketch, 0.99);
+        result->max_wait = sketch->max;
+    }
+    if (bursts != NULL) {
+        fclose(bursts);
+    }
+    if (levels != NULL) {
+        fclose(levels);
+    }
+    free(sketch);
+    return status;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "parta_stream.h"
+
+/**
+ * Out-of-core Round-Robin for traces that do not fit in memory. Waits
+ * come from the closed form of rr_analytic_run (parta_inc.h): a per-level
+ * term from the sorted bursts plus a correction for earlier processes,
+ * where a process' level is the number of rounds it needs. The bursts
+ * are sorted with an external merge sort (runs spilled under tmp_dir)
+ * to build the level table, then waits are computed by scanning the
+ * bursts in pid order, one band of levels at a time so the per-level
+ * state fits the budget. With more than one band, each band's
+ * (pid, wait) pairs are spilled and merged back into pid order.
+ */
+struct ooc_config {
+    const char* tmp_dir; /** Spill directory, NULL for $TMPDIR or /tmp */
+    size_t mem_bytes;    /** Memory budget for runs, levels and merge buffers */
+};
+
+/** Summary of an out-of-core run */
+struct ooc_result {
+    long long plen;       /** Processes read (pid of the bad burst on STREAM_EINPUT) */
+    long long total_time; /** Sum of positive bursts */
+    double avg_wait;
+    long long p50_wait;   /** Quantiles from a wait_sketch */
+    long long p99_wait;
+    long long max_wait;
+    int runs;             /** Sorted runs spilled */
+    int bands;            /** Scans of the bursts needed for the levels */
+};
+
+
+enum stream_status rr_ooc_run(int in_fd, int quantum, const struct ooc_config* config,
+                              struct out_buf* out, struct ooc_result* result);
@@ -0,0 +1,247 @@
+#include "parta_opt.h"
+#include "parta_algo.h"
+#include "parta_inc.h"
+#include <stdlib.h>
+#include <string.h>
+
+static int rounds(int b, int q) {
+    return (b > 0) ? (int)(((long long)b + q - 1) / q) : 0;
+}
+
+static int cmp_int(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+/** Growable array of candidate quanta */
+struct quanta {
+    int* q;
+    int len;
+    int cap;
+};
+
+static bool quanta_add(struct quanta* qs, int q, int lo, int hi) {
+    if (q < lo || q > hi) {
+        return true;
+    }
+    if (qs->len == qs->cap) {
+        int cap = (qs->cap > 0) ? qs->cap * 2 : 64;
+        int* grown = realloc(qs->q, sizeof(int) * cap);
+        if (grown == NULL) {
+            return false;
+        }
+        qs->q = grown;
+        qs->cap = cap;
+    }
+    qs->q[qs->len++] = q;
+    return true;
+}
+
+/**
+ * Collect the quanta in [lo, hi] at which the waits of `procs` under
+ * Round-Robin can change slope: ceil(b / k) and ceil(b / k) - 1 for every
+ * burst b and round count k, plus lo and hi themselves. The distinct
+ * values of ceil(b / k) are walked in blocks of k that share one value,
+ * O(sqrt(b)) steps per distinct burst.
+ *
+ * Returns the number of quanta, sorted and unique, stored in a fresh
+ * array at *out; or -1 on allocation failure.
+ */
+int rr_quantum_candidates(const struct pcb* procs, int plen, int lo, int hi, int** out) {
+    if (procs == NULL || plen < 0 || out == NULL || lo > hi) {
+        return -1;
+    }
+
+    int* bursts = malloc(sizeof(int) * (plen + 1));
+    struct quanta qs = { NULL, 0, 0 };
+    bool ok = bursts != NULL && quanta_add(&qs, lo, lo, hi) && quanta_add(&qs, hi, lo, hi);
+    int m = 0;
+    for (int i = 0; ok && i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            bursts[m++] = procs[i].burst_left;
+        }
+    }
+    if (ok) {
+        qsort(bursts, m, sizeof(int), cmp_int);
+    }
+
+    for (int i = 0; ok && i < m; i++) {
+        long long b = bursts[i];
+        if (i > 0 && bursts[i - 1] == b) {
+            continue;
+        }
+        // Skip the k whose quanta all lie above hi.
+        long long k = (b > hi) ? b / ((long long)hi + 1) : 1;
+        k = (k > 0) ? k : 1;
+        for (;;) {
+            long long v = (b + k - 1) / k;
+            if (v < lo) {
+                break;
+            }
+            ok = quanta_add(&qs, (int)v, lo, hi) && quanta_add(&qs, (int)v - 1, lo, hi);
+            if (!ok || v == 1) {
+                break;
+            }
+            // Largest k with ceil(b / k) == v, then the first one past it.
+            k = (b - 1) / (v - 1) + 1;
+        }
+    }
+    free(bursts);
+
+    if (!ok) {
+        free(qs.q);
+        return -1;
+    }
+    qsort(qs.q, qs.len, sizeof(int), cmp_int);
+    int n = 0;
+    for (int i = 0; i < qs.len; i++) {
+        if (n == 0 || qs.q[n - 1] != qs.q[i]) {
+            qs.q[n++] = qs.q[i];
+        }
+    }
+    *out = qs.q;
+    return n;
+}
+
+/**
+ * Sum over processes of the context switches each one waits through
+ * under rr_run_cost at this quantum, and the number of switches overall.
+ *
+ * Process i is runnable until its last slice, and every slice up to then
+ * starts with a switch: its own c_i slices plus, from every other j,
+ * min(c_j, c_i - 1 + [j < i]). That is the closed form of the waits with
+ * bursts c and quantum 1, so rr_analytic_run counts them. The only
+ * slices without a switch are those of the last process left running
+ * after the others have finished.
+ *
+ * Returns false on allocation failure.
+ */
+static bool count_switches(const struct pcb* procs, int plen, int quantum,
+                           long long* waited, long long* switches) {
+    struct pcb* slices = malloc(sizeof(struct pcb) * plen);
+    if (slices == NULL) {
+        return false;
+    }
+
+    long long total = 0;
+    int last = -1;
+    for (int i = 0; i < plen; i++) {
+        int c = rounds(procs[i].burst_left, quantum);
+        slices[i] = (struct pcb){ i, c, 0, 0 };
+        total += c;
+        last = (c > 0 && (last < 0 || c >= slices[last].burst_left)) ? i : last;
+    }
+    if (last < 0) {
+        free(slices);
+        *waited = *switches = 0;
+        return true;
+    }
+
+    // The last process finishes last; `next` is the last of the others.
+    int next = -1;
+    for (int i = 0; i < plen; i++) {
+        if (i != last && slices[i].burst_left > 0 &&
+            (next < 0 || slices[i].burst_left >= slices[next].burst_left)) {
+            next = i;
+        }
+    }
+    long long alone = (next < 0) ? slices[last].burst_left - 1
+                                 : slices[last].burst_left - slices[next].burst_left -
+                                       (last < next ? 1 : 0);
+
+    long long sum = total - alone;
+    rr_analytic_run(slices, plen, 1);
+    for (int i = 0; i < plen; i++) {
+        sum += slices[i].wait;
+    }
+    free(slices);
+    *waited = sum;
+    *switches = total - alone;
+    return true;
+}
+
+/**
+ * Find the quantum in [min_quantum, max_quantum] that minimizes the
+ * configured objective for `procs` (all arriving at time 0), evaluating
+ * each candidate from rr_quantum_candidates with rr_analytic_run.
+ *
+ * The mean wait, with or without a dispatch cost per switch, is linear
+ * between candidates, so that optimum is exact. The p99 wait is an order
+ * statistic of linear functions and can also bend where two waits cross;
+ * it is only evaluated at the same candidates.
+ *
+ * Returns true on success.
+ */
+bool rr_optimize(const struct pcb* procs, int plen, const struct opt_config* config,
+                 struct opt_result* result) {
+    if (procs == NULL || plen <= 0 || config == NULL || result == NULL) {
+        return false;
+    }
+
+    // Any quantum of at least the largest burst runs FCFS.
+    int max_burst = 1;
+    long long sum_burst = 0;
+    for (int i = 0; i < plen; i++) {
+        max_burst = (procs[i].burst_left > max_burst) ? procs[i].burst_left : max_burst;
+        sum_burst += (procs[i].burst_left > 0) ? procs[i].burst_left : 0;
+    }
+    int lo = (config->min_quantum > 0) ? config->min_quantum : 1;
+    int hi = (config->max_quantum > 0) ? config->max_quantum : max_burst;
+    if (hi < lo) {
+        return false;
+    }
+    result->range = hi - lo + 1;
+    hi = (hi > max_burst) ? ((lo > max_burst) ? lo : max_burst) : hi;
+
+    int* quanta = NULL;
+    int n = rr_quantum_candidates(procs, plen, lo, hi, &quanta);
+    struct pcb* scratch = (n > 0) ? malloc(sizeof(struct pcb) * plen) : NULL;
+    if (scratch == NULL) {
+        free(quanta);
+        return false;
+    }
+
+    bool ok = true;
+    long long best = 0;
+    for (int c = 0; ok && c < n; c++) {
+        int q = quanta[c];
+        memcpy(scratch, procs, sizeof(struct pcb) * plen);
+        int total_time = rr_analytic_run(scratch, plen, q);
+        struct sched_result summary;
+        long long sum_wait = 0;
+        for (int i = 0; i < plen; i++) {
+            sum_wait += scratch[i].wait - procs[i].wait;
+        }
+        ok = (total_time > 0 || sum_burst == 0) &&
+             sched_summarize(scratch, plen, total_time, &summary);
+
+        // Scores stay integral so ties are exact: the mean objectives
+        // compare sums, the p99 compares the wait itself.
+        long long waited = 0;
+        long long switches = 0;
+        if (ok && config->objective == OPT_SWITCH && config->dispatch > 0) {
+            ok = count_switches(procs, plen, q, &waited, &switches);
+        }
+        long long score = (config->objective == OPT_P99_WAIT) ? summary.p99_wait
+                          : (config->objective == OPT_SWITCH)
+                              ? sum_wait + (long long)config->dispatch * waited
+                              : sum_wait;
+        if (ok && (c == 0 || score <= best)) {
+            best = score;
+            result->quantum = q;
+            result->score = (config->objective == OPT_P99_WAIT) ? (double)score
+                                                                : (double)score / plen;
+            result->avg_wait = (double)sum_wait / plen;
+            result->p99_wait = summary.p99_wait;
+            result->total_time =
+                (int)(sum_burst + ((config->objective == OPT_SWITCH && config->dispatch > 0)
+                                       ? (long long)config->dispatch * switches
+                                       : 0));
+        }
+    }
+    result->candidates = n;
+    free(scratch);
+    free(quanta);
+    return ok;
+}
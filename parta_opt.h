@@ -0,0 +1,45 @@
+#pragma once
+
+#include "parta.h"
+
+/**
+ * Round-Robin quantum optimizer. With every process arriving at time 0,
+ * the wait of each process (see parta_inc.h) only changes shape where
+ * q * k crosses some burst b for an integer k: between two consecutive
+ * breakpoints b / k, every round count is fixed and every wait, hence
+ * the mean, is linear in q. The optimum over integer quanta therefore
+ * lies at floor or ceil of a breakpoint, and rr_optimize only evaluates
+ * those: O(sqrt(b)) distinct values of ceil(b / k) per distinct burst b
+ * instead of every quantum up to the largest burst.
+ */
+
+/** What rr_optimize minimizes */
+enum opt_objective {
+    OPT_MEAN_WAIT, /** Average wait */
+    OPT_P99_WAIT,  /** 99th percentile wait (nearest rank) */
+    OPT_SWITCH,    /** Average wait under rr_run_cost with a fixed dispatch cost */
+};
+
+/** Search settings of rr_optimize */
+struct opt_config {
+    enum opt_objective objective;
+    int dispatch;    /** Ticks per context switch (OPT_SWITCH only) */
+    int min_quantum; /** Smallest quantum to consider, <= 0 for 1 */
+    int max_quantum; /** Largest quantum to consider, <= 0 for the largest burst */
+};
+
+/** Best quantum found by rr_optimize */
+struct opt_result {
+    int quantum;     /** Quantum with the lowest score (the larger one on ties) */
+    double score;    /** Value of the objective at that quantum */
+    double avg_wait; /** Average wait at that quantum, without switch costs */
+    int p99_wait;    /** 99th percentile wait at that quantum, without switch costs */
+    int total_time;  /** Total time at that quantum, switch costs included */
+    int candidates;  /** Quanta evaluated */
+    int range;       /** Quanta in the searched range */
+};
+
+
+int rr_quantum_candidates(const struct pcb* procs, int plen, int lo, int hi, int** out);
+bool rr_optimize(const struct pcb* procs, int plen, const struct opt_config* config,
+                 struct opt_result* result);
@@ -0,0 +1,415 @@
+#include "parta_rt.h"
+#include <stdlib.h>
+#include <limits.h>
+
+/** One job instance (or, in the event queue, a pending release) */
+struct rt_job {
+    int key;       /* Heap order: deadline (EDF), rank (RM) or release time */
+    int release;   /* Release time */
+    int deadline;  /* Absolute deadline */
+    int remaining; /* Execution time still needed */
+    int task;      /* Index of the task that released this job */
+};
+
+/** Binary min-heap of jobs ordered by (key, release, task) */
+struct rt_heap {
+    struct rt_job* a;
+    int len;
+    int cap;
+};
+
+static bool job_before(const struct rt_job* x, const struct rt_job* y) {
+    if (x->key != y->key) return x->key < y->key;
+    if (x->release != y->release) return x->release < y->release;
+    return x->task < y->task;
+}
+
+static bool heap_push(struct rt_heap* h, struct rt_job job) {
+    if (h->len == h->cap) {
+        int cap = (h->cap == 0) ? 16 : h->cap * 2;
+        struct rt_job* a = realloc(h->a, sizeof(struct rt_job) * cap);
+        if (a == NULL) {
+            return false;
+        }
+        h->a = a;
+        h->cap = cap;
+    }
+
+    int i = h->len++;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!job_before(&job, &h->a[parent])) {
+            break;
+        }
+        h->a[i] = h->a[parent];
+        i = parent;
+    }
+    h->a[i] = job;
+    return true;
+}
+
+static struct rt_job heap_pop(struct rt_heap* h) {
+    struct rt_job top = h->a[0];
+    struct rt_job last = h->a[--h->len];
+
+    int i = 0;
+    while (1) {
+        int child = 2 * i + 1;
+        if (child >= h->len) {
+            break;
+        }
+        if (child + 1 < h->len && job_before(&h->a[child + 1], &h->a[child])) {
+            child++;
+        }
+        if (!job_before(&h->a[child], &last)) {
+            break;
+        }
+        h->a[i] = h->a[child];
+        i = child;
+    }
+    if (h->len > 0) {
+        h->a[i] = last;
+    }
+    return top;
+}
+
+static int rel_deadline(const struct rt_task* t) {
+    return (t->deadline > 0) ? t->deadline : t->period;
+}
+
+/** Whether every task has a positive period and WCET, as rt_run requires */
+static bool tasks_valid(const struct rt_task* tasks, int n) {
+    for (int i = 0; i < n; i++) {
+        if (tasks[i].period <= 0 || tasks[i].wcet <= 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static long long gcd_ll(long long a, long long b) {
+    while (b != 0) {
+        long long r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+/**
+ * Least common multiple of all task periods.
+ *
+ * Returns -1 if a period is not positive or the result exceeds INT_MAX.
+ */
+long long rt_hyperperiod(const struct rt_task* tasks, int n) {
+    if (tasks == NULL || n <= 0) {
+        return -1;
+    }
+
+    long long h = 1;
+    for (int i = 0; i < n; i++) {
+        if (tasks[i].period <= 0) {
+            return -1;
+        }
+        h = h / gcd_ll(h, tasks[i].period) * tasks[i].period;
+        if (h > INT_MAX) {
+            return -1;
+        }
+    }
+    return h;
+}
+
+/**
+ * Total processor utilization, sum of wcet / period.
+ *
+ * Returns -1.0 if a period or WCET is not positive.
+ */
+double rt_utilization(const struct rt_task* tasks, int n) {
+    if (tasks != NULL && !tasks_valid(tasks, n)) {
+        return -1.0;
+    }
+    double u = 0.0;
+    for (int i = 0; tasks != NULL && i < n; i++) {
+        u += (double)tasks[i].wcet / tasks[i].period;
+    }
+    return u;
+}
+
+/**
+ * Sufficient RM test for implicit-deadline tasks: the hyperbolic bound
+ * prod(U_i + 1) <= 2, which accepts every set the Liu & Layland bound
+ * n(2^(1/n) - 1) accepts. False if a period or WCET is not positive.
+ */
+bool rt_rm_bound(const struct rt_task* tasks, int n) {
+    if (tasks != NULL && !tasks_valid(tasks, n)) {
+        return false;
+    }
+    double prod = 1.0;
+    for (int i = 0; tasks != NULL && i < n; i++) {
+        prod *= (double)tasks[i].wcet / tasks[i].period + 1.0;
+    }
+    return prod <= 2.0;
+}
+
+/**
+ * EDF density test: sum of wcet / min(deadline, period) <= 1.
+ * Exact when every deadline equals its period, sufficient otherwise.
+ * False if a period or WCET is not positive.
+ */
+bool rt_edf_test(const struct rt_task* tasks, int n) {
+    if (tasks != NULL && !tasks_valid(tasks, n)) {
+        return false;
+    }
+    double density = 0.0;
+    for (int i = 0; tasks != NULL && i < n; i++) {
+        int d = rel_deadline(&tasks[i]);
+        density += (double)tasks[i].wcet / ((d < tasks[i].period) ? d : tasks[i].period);
+    }
+    return density <= 1.0;
+}
+
+/**
+ * Rank tasks by RM priority: shorter period first, ties by index.
+ * rank[i] is 0 for the highest-priority task.
+ */
+static bool rm_ranks(const struct rt_task* tasks, int n, int* rank) {
+    int* order = malloc(sizeof(int) * n);
+    if (order == NULL) {
+        return false;
+    }
+
+    // Insertion sort: task sets are small and this keeps ties stable.
+    for (int i = 0; i < n; i++) {
+        int j = i;
+        while (j > 0 && tasks[order[j - 1]].period > tasks[i].period) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+    for (int r = 0; r < n; r++) {
+        rank[order[r]] = r;
+    }
+
+    free(order);
+    return true;
+}
+
+/**
+ * Exact RM response-time analysis. For each task i, iterates
+ *   R = wcet_i + sum over higher-priority j of ceil(R / period_j) * wcet_j
+ * to a fixed point, stopping early once R exceeds the deadline.
+ *
+ * If response is not NULL it receives each task's worst-case response
+ * time (or the first value past the deadline).
+ *
+ * Returns true if every task meets its deadline, false if not or if a
+ * period or WCET is not positive.
+ */
+bool rt_rm_rta(const struct rt_task* tasks, int n, int* response) {
+    if (tasks == NULL || n <= 0 || !tasks_valid(tasks, n)) {
+        return false;
+    }
+
+    int* rank = malloc(sizeof(int) * n);
+    if (rank == NULL || !rm_ranks(tasks, n, rank)) {
+        free(rank);
+        return false;
+    }
+
+    bool ok = true;
+    for (int i = 0; i < n; i++) {
+        long long d = rel_deadline(&tasks[i]);
+        long long r = tasks[i].wcet;
+        long long prev = -1;
+
+        while (r != prev && r <= d) {
+            prev = r;
+            r = tasks[i].wcet;
+            for (int j = 0; j < n; j++) {
+                if (rank[j] < rank[i]) {
+                    r += (prev + tasks[j].period - 1) / tasks[j].period * tasks[j].wcet;
+                }
+            }
+        }
+
+        if (r > d) {
+            ok = false;
+        }
+        if (response != NULL) {
+            response[i] = (r > INT_MAX) ? INT_MAX : (int)r;
+        }
+    }
+
+    free(rank);
+    return ok;
+}
+
+static unsigned xorshift32(unsigned* state) {
+    unsigned x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/**
+ * Simulate a task set under EDF or RM until `horizon` (0 means one
+ * hyperperiod past the largest phase).
+ *
+ * The simulation is event driven: it jumps from one release or
+ * completion to the next, so idle time costs nothing. Jobs of the same
+ * task that overlap are queued behind each other.
+ *
+ * procs (n entries) receives one PCB per task:
+ *   - pid = task index
+ *   - burst_left = work still pending at the horizon
+ *   - wait = total time its jobs spent ready but not running
+ *   - priority = RM rank (0 under EDF)
+ *
+ * Sporadic tasks (jitter > 0) add a pseudo-random gap in [0, jitter]
+ * to each inter-arrival time, drawn from `seed`.
+ *
+ * Returns the simulated time, or -1 on invalid input.
+ */
+int rt_run(const struct rt_task* tasks, int n, enum rt_policy policy, int horizon,
+           unsigned seed, struct pcb* procs, struct rt_stats* stats) {
+    if (tasks == NULL || procs == NULL || n <= 0) {
+        return -1;
+    }
+    for (int i = 0; i < n; i++) {
+        if (tasks[i].period <= 0 || tasks[i].wcet <= 0 || tasks[i].phase < 0) {
+            return -1;
+        }
+    }
+
+    if (horizon <= 0) {
+        long long h = rt_hyperperiod(tasks, n);
+        int max_phase = 0;
+        for (int i = 0; i < n; i++) {
+            if (tasks[i].phase > max_phase) {
+                max_phase = tasks[i].phase;
+            }
+        }
+        if (h < 0 || h + max_phase > INT_MAX) {
+            return -1;
+        }
+        horizon = (int)h + max_phase;
+    }
+
+    int* rank = malloc(sizeof(int) * n);
+    if (rank == NULL || !rm_ranks(tasks, n, rank)) {
+        free(rank);
+        return -1;
+    }
+
+    struct rt_stats st = { 0 };
+    st.task_misses = (stats != NULL) ? stats->task_misses : NULL;
+    for (int i = 0; i < n; i++) {
+        procs[i].pid = i;
+        procs[i].burst_left = 0;
+        procs[i].wait = 0;
+        procs[i].priority = (policy == RT_RM) ? rank[i] : 0;
+        if (st.task_misses != NULL) {
+            st.task_misses[i] = 0;
+        }
+    }
+
+    struct rt_heap releases = { 0 };
+    struct rt_heap ready = { 0 };
+    unsigned rng = (seed != 0) ? seed : 1;
+    bool ok = true;
+
+    for (int i = 0; i < n && ok; i++) {
+        if (tasks[i].phase < horizon) {
+            struct rt_job r = { tasks[i].phase, tasks[i].phase, 0, 0, i };
+            ok = heap_push(&releases, r);
+        }
+    }
+
+    int t = 0;
+    while (ok) {
+        // Release every job due at or before t.
+        while (ok && releases.len > 0 && releases.a[0].release <= t) {
+            struct rt_job r = heap_pop(&releases);
+            const struct rt_task* task = &tasks[r.task];
+
+            struct rt_job job = r;
+            job.deadline = r.release + rel_deadline(task);
+            job.remaining = task->wcet;
+            job.key = (policy == RT_EDF) ? job.deadline : rank[r.task];
+            ok = heap_push(&ready, job);
+            st.jobs++;
+            st.events++;
+
+            long long next = (long long)r.release + task->period;
+            if (task->jitter > 0) {
+                next += xorshift32(&rng) % ((unsigned)task->jitter + 1);
+            }
+            if (ok && next < horizon) {
+                r.release = (int)next;
+                r.key = (int)next;
+                ok = heap_push(&releases, r);
+            }
+        }
+        if (!ok || t >= horizon) {
+            break;
+        }
+
+        int next_event = (releases.len > 0) ? releases.a[0].release : horizon;
+        if (ready.len == 0) {
+            // Idle: skip straight to the next release.
+            t = next_event;
+            continue;
+        }
+
+        struct rt_job* job = &ready.a[0];
+        int run_time = next_event - t;
+        if (job->remaining < run_time) {
+            run_time = job->remaining;
+        }
+        t += run_time;
+        st.busy += run_time;
+        job->remaining -= run_time;
+
+        if (job->remaining == 0) {
+            struct rt_job finished = heap_pop(&ready);
+            procs[finished.task].wait += t - finished.release - tasks[finished.task].wcet;
+            st.done++;
+            st.events++;
+            if (t > finished.deadline) {
+                st.misses++;
+                if (st.task_misses != NULL) {
+                    st.task_misses[finished.task]++;
+                }
+            }
+        }
+    }
+
+    // Jobs still pending at the horizon.
+    for (int j = 0; ok && j < ready.len; j++) {
+        const struct rt_job* job = &ready.a[j];
+        int ran = tasks[job->task].wcet - job->remaining;
+        procs[job->task].burst_left += job->remaining;
+        procs[job->task].wait += horizon - job->release - ran;
+        if (job->deadline <= horizon) {
+            st.misses++;
+            if (st.task_misses != NULL) {
+                st.task_misses[job->task]++;
+            }
+        }
+    }
+
+    free(releases.a);
+    free(ready.a);
+    free(rank);
+
+    if (!ok) {
+        return -1;
+    }
+    if (stats != NULL) {
+        *stats = st;
+    }
+    return horizon;
+}
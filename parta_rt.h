@@ -0,0 +1,38 @@
+#pragma once
+
+#include "parta.h"
+
+/** A periodic or sporadic real-time task */
+struct rt_task {
+    int period;   /** Period, or minimum inter-arrival time if sporadic */
+    int wcet;     /** Worst-case execution time of every job */
+    int deadline; /** Relative deadline, 0 means equal to the period */
+    int phase;    /** Release time of the first job */
+    int jitter;   /** Sporadic only: max extra gap added to each inter-arrival */
+};
+
+/** Real-time scheduling policy */
+enum rt_policy {
+    RT_EDF, /** Earliest-Deadline-First */
+    RT_RM,  /** Rate-Monotonic (shorter period = higher priority) */
+};
+
+/** Counters collected by rt_run */
+struct rt_stats {
+    int jobs;    /** Jobs released before the horizon */
+    int done;    /** Jobs completed before the horizon */
+    int misses;  /** Jobs that missed their deadline */
+    int busy;    /** Time the CPU spent running jobs */
+    int events;  /** Scheduler events processed (releases + completions) */
+    int* task_misses; /** Optional per-task miss counts (n entries), or NULL */
+};
+
+
+long long rt_hyperperiod(const struct rt_task* tasks, int n);
+double rt_utilization(const struct rt_task* tasks, int n);
+bool rt_rm_bound(const struct rt_task* tasks, int n);
+bool rt_edf_test(const struct rt_task* tasks, int n);
+bool rt_rm_rta(const struct rt_task* tasks, int n, int* response);
+
+int rt_run(const struct rt_task* tasks, int n, enum rt_policy policy, int horizon,
+           unsigned seed, struct pcb* procs, struct rt_stats* stats);
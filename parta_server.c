@@ -0,0 +1,818 @@
+#define _GNU_SOURCE /* accept4 */
+#include "parta_server.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/** PCBs preallocated per worker when the config does not say */
+#define SRV_ARENA_DEFAULT 65536
+
+/** Client connection, owned by the event loop thread */
+struct srv_conn {
+    int fd;
+    unsigned char* in;   /* Bytes read but not yet parsed */
+    size_t in_len;
+    size_t in_cap;
+    unsigned char* out;  /* Responses not yet written */
+    size_t out_len;
+    size_t out_off;
+    size_t out_cap;
+    int inflight;        /* Requests queued or running on workers */
+    bool eof;            /* Peer finished sending */
+    bool closed;         /* fd closed, waiting for inflight to drain */
+    bool want_out;       /* Registered for EPOLLOUT */
+    struct srv_conn* prev;
+    struct srv_conn* next;
+};
+
+/** A parsed request travelling loop -> worker -> loop */
+struct srv_job {
+    struct srv_job* next;
+    struct srv_conn* conn;
+    uint32_t req_id;
+    bool valid;                /* spec parsed successfully */
+    struct sched_spec spec;
+    int plen;
+    int32_t* payload;          /* plen (burst, priority) pairs */
+    struct srv_response resp;
+};
+
+/** FIFO of jobs guarded by the server mutex */
+struct srv_queue {
+    struct srv_job* head;
+    struct srv_job* tail;
+};
+
+struct parta_server {
+    char path[sizeof(((struct sockaddr_un*)0)->sun_path)];
+    int listen_fd;
+    int epoll_fd;
+    int wake_fd;  /* Workers signal completed jobs */
+    int stop_fd;  /* server_stop signals shutdown */
+    int threads;
+    int arena_procs;
+    struct result_cache* cache; /* Shared by all workers, or NULL */
+
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+    struct srv_queue todo;
+    struct srv_queue done;
+    bool stopping;
+
+    struct srv_conn* conns;
+    struct srv_conn* retired; /* Closed and drained, freed after the epoll batch */
+};
+
+static void queue_push(struct srv_queue* q, struct srv_job* job) {
+    job->next = NULL;
+    if (q->tail != NULL) {
+        q->tail->next = job;
+    } else {
+        q->head = job;
+    }
+    q->tail = job;
+}
+
+static struct srv_job* queue_take_all(struct srv_queue* q) {
+    struct srv_job* head = q->head;
+    q->head = NULL;
+    q->tail = NULL;
+    return head;
+}
+
+static void job_free(struct srv_job* job) {
+    free(job->payload);
+    free(job);
+}
+
+/**
+ * Create a server listening on config->path. Nothing is served until
+ * server_run is called.
+ *
+ * Returns the server (free with server_free), or NULL on failure.
+ */
+struct parta_server* server_create(const struct srv_config* config) {
+    if (config == NULL || config->path == NULL) {
+        return NULL;
+    }
+
+    struct parta_server* s = calloc(1, sizeof(struct parta_server));
+    if (s == NULL) {
+        return NULL;
+    }
+    if (strlen(config->path) >= sizeof(s->path)) {
+        free(s);
+        return NULL;
+    }
+    strcpy(s->path, config->path);
+    s->threads = config->threads;
+    if (s->threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        s->threads = (cpus > 0) ? (int)cpus : 1;
+    }
+    s->arena_procs = (config->arena_procs > 0) ? config->arena_procs : SRV_ARENA_DEFAULT;
+    s->listen_fd = -1;
+    s->epoll_fd = -1;
+    s->wake_fd = -1;
+    s->stop_fd = -1;
+    pthread_mutex_init(&s->lock, NULL);
+    pthread_cond_init(&s->ready, NULL);
+    if (config->cache_bytes > 0) {
+        s->cache = cache_create(config->cache_bytes, config->cache_dir);
+        if (s->cache == NULL) {
+            server_free(s);
+            return NULL;
+        }
+    }
+
+    struct sockaddr_un addr = { 0 };
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, s->path);
+    unlink(s->path);
+
+    s->listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    s->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    s->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    s->stop_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (s->listen_fd < 0 || s->epoll_fd < 0 || s->wake_fd < 0 || s->stop_fd < 0 ||
+        bind(s->listen_fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+        listen(s->listen_fd, SOMAXCONN) < 0) {
+        server_free(s);
+        return NULL;
+    }
+
+    // The listening socket, wake and stop fds are told apart from
+    // connections by pointing at the fd fields themselves.
+    int* fds[] = { &s->listen_fd, &s->wake_fd, &s->stop_fd };
+    for (int i = 0; i < 3; i++) {
+        struct epoll_event ev = { .events = EPOLLIN, .data.ptr = fds[i] };
+        if (epoll_ctl(s->epoll_fd, EPOLL_CTL_ADD, *fds[i], &ev) < 0) {
+            server_free(s);
+            return NULL;
+        }
+    }
+    return s;
+}
+
+/**
+ * Ask server_run to return. Safe to call from any thread or from a
+ * signal handler.
+ */
+void server_stop(struct parta_server* s) {
+    uint64_t one = 1;
+    ssize_t n = write(s->stop_fd, &one, sizeof(one));
+    (void)n;
+}
+
+static void conn_free(struct srv_conn* c) {
+    free(c->in);
+    free(c->out);
+    free(c);
+}
+
+/**
+ * Move a closed connection with nothing in flight from s->conns to
+ * s->retired. Later events of the current epoll batch may still point at
+ * it, so it is only freed by conn_reap once the batch is done.
+ */
+static void conn_retire(struct parta_server* s, struct srv_conn* c) {
+    if (c->prev != NULL) {
+        c->prev->next = c->next;
+    } else {
+        s->conns = c->next;
+    }
+    if (c->next != NULL) {
+        c->next->prev = c->prev;
+    }
+    c->prev = NULL;
+    c->next = s->retired;
+    s->retired = c;
+}
+
+static void conn_reap(struct parta_server* s) {
+    while (s->retired != NULL) {
+        struct srv_conn* c = s->retired;
+        s->retired = c->next;
+        conn_free(c);
+    }
+}
+
+/** Stop serving a connection; it is retired once its last job completes. */
+static void conn_close(struct parta_server* s, struct srv_conn* c) {
+    if (c->closed) {
+        return;
+    }
+    epoll_ctl(s->epoll_fd, EPOLL_CTL_DEL, c->fd, NULL);
+    close(c->fd);
+    c->closed = true;
+    if (c->inflight == 0) {
+        conn_retire(s, c);
+    }
+}
+
+static void conn_watch(struct parta_server* s, struct srv_conn* c, bool want_out) {
+    struct epoll_event ev = { .events = (c->eof ? 0 : EPOLLIN) | (want_out ? EPOLLOUT : 0),
+                              .data.ptr = c };
+    epoll_ctl(s->epoll_fd, EPOLL_CTL_MOD, c->fd, &ev);
+    c->want_out = want_out;
+}
+
+/**
+ * Write as much pending output as the socket takes. A connection whose
+ * peer has finished sending is closed once everything is answered.
+ *
+ * Returns false if the connection was closed.
+ */
+static bool conn_flush(struct parta_server* s, struct srv_conn* c) {
+    while (c->out_off < c->out_len) {
+        ssize_t n = send(c->fd, c->out + c->out_off, c->out_len - c->out_off, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            if (!c->want_out) {
+                conn_watch(s, c, true);
+            }
+            return true;
+        }
+        if (n <= 0) {
+            conn_close(s, c);
+            return false;
+        }
+        c->out_off += (size_t)n;
+    }
+
+    c->out_off = 0;
+    c->out_len = 0;
+    if (c->want_out) {
+        conn_watch(s, c, false);
+    }
+    if (c->eof && c->inflight == 0) {
+        conn_close(s, c);
+        return false;
+    }
+    return true;
+}
+
+static bool buf_reserve(unsigned char** buf, size_t* cap, size_t need) {
+    if (need <= *cap) {
+        return true;
+    }
+    size_t new_cap = (*cap > 0) ? *cap : 4096;
+    while (new_cap < need) {
+        new_cap *= 2;
+    }
+    unsigned char* p = realloc(*buf, new_cap);
+    if (p == NULL) {
+        return false;
+    }
+    *buf = p;
+    *cap = new_cap;
+    return true;
+}
+
+static bool conn_respond(struct srv_conn* c, const struct srv_response* r) {
+    unsigned char frame[4 + SRV_RESP_BODY];
+    uint32_t len = SRV_RESP_BODY;
+    memcpy(frame, &len, 4);
+    memcpy(frame + 4, &r->req_id, 4);
+    memcpy(frame + 8, &r->status, 4);
+    memcpy(frame + 12, &r->total_time, 4);
+    memcpy(frame + 16, &r->p99_wait, 4);
+    memcpy(frame + 20, &r->avg_wait, 8);
+
+    if (!buf_reserve(&c->out, &c->out_cap, c->out_len + sizeof(frame))) {
+        return false;
+    }
+    memcpy(c->out + c->out_len, frame, sizeof(frame));
+    c->out_len += sizeof(frame);
+    return true;
+}
+
+/**
+ * Turn one request body into a job. The algorithm and parameter are
+ * checked here so workers only ever see runnable specs.
+ */
+static struct srv_job* job_parse(struct srv_conn* c, const unsigned char* body, uint32_t plen) {
+    struct srv_job* job = calloc(1, sizeof(struct srv_job));
+    if (job == NULL) {
+        return NULL;
+    }
+    job->conn = c;
+    job->plen = (int)plen;
+    memcpy(&job->req_id, body, 4);
+
+    int32_t param;
+    char name[SRV_ALGO_LEN + 1];
+    memcpy(&param, body + 4, 4);
+    memcpy(name, body + 12, SRV_ALGO_LEN);
+    name[SRV_ALGO_LEN] = '\0';
+
+    // Reuse the command-line spec parser so both front ends validate
+    // parameters the same way.
+    char text[SRV_ALGO_LEN + 16];
+    const struct sched_algo* algo = sched_find(name);
+    if (algo != NULL && (algo->flags & SCHED_PARAM)) {
+        snprintf(text, sizeof(text), "%s:%d", name, (int)param);
+    } else {
+        snprintf(text, sizeof(text), "%s", name);
+    }
+    job->valid = sched_parse_spec(text, &job->spec);
+
+    if (job->valid && plen > 0) {
+        job->payload = malloc(sizeof(int32_t) * 2 * plen);
+        if (job->payload == NULL) {
+            free(job);
+            return NULL;
+        }
+        memcpy(job->payload, body + SRV_REQ_HEADER, sizeof(int32_t) * 2 * plen);
+    }
+    return job;
+}
+
+/**
+ * Split the input buffer into frames and queue a job for each complete
+ * one. A partial frame stays buffered until more bytes arrive.
+ *
+ * Returns false if the stream is malformed.
+ */
+static bool conn_parse(struct parta_server* s, struct srv_conn* c) {
+    size_t off = 0;
+    struct srv_queue jobs = { NULL, NULL };
+    bool ok = true;
+
+    // The length and plen fields are both within the first 16 bytes.
+    while (c->in_len - off >= 16) {
+        uint32_t len;
+        memcpy(&len, c->in + off, 4);
+        if (len < SRV_REQ_HEADER) {
+            ok = false;
+            break;
+        }
+        uint32_t plen;
+        memcpy(&plen, c->in + off + 12, 4);
+        if (plen > SRV_MAX_PROCS || len != SRV_REQ_HEADER + 8 * plen) {
+            ok = false;
+            break;
+        }
+        if (c->in_len - off - 4 < len) {
+            break;
+        }
+
+        struct srv_job* job = job_parse(c, c->in + off + 4, plen);
+        if (job == NULL) {
+            ok = false;
+            break;
+        }
+        queue_push(&jobs, job);
+        c->inflight++;
+        off += 4 + (size_t)len;
+    }
+
+    memmove(c->in, c->in + off, c->in_len - off);
+    c->in_len -= off;
+
+    if (jobs.head != NULL) {
+        pthread_mutex_lock(&s->lock);
+        for (struct srv_job* job = jobs.head; job != NULL;) {
+            struct srv_job* next = job->next;
+            queue_push(&s->todo, job);
+            job = next;
+        }
+        pthread_cond_broadcast(&s->ready);
+        pthread_mutex_unlock(&s->lock);
+    }
+    return ok;
+}
+
+static void conn_read(struct parta_server* s, struct srv_conn* c) {
+    while (1) {
+        if (!buf_reserve(&c->in, &c->in_cap, c->in_len + 4096)) {
+            conn_close(s, c);
+            return;
+        }
+        ssize_t n = read(c->fd, c->in + c->in_len, c->in_cap - c->in_len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        }
+        if (n < 0) {
+            conn_close(s, c);
+            return;
+        }
+        if (n == 0) {
+            // Half-close: answer what is in flight, then close.
+            c->eof = true;
+            conn_watch(s, c, c->want_out);
+            break;
+        }
+        c->in_len += (size_t)n;
+    }
+
+    if (!conn_parse(s, c)) {
+        conn_close(s, c);
+        return;
+    }
+    if (c->eof && c->inflight == 0 && c->out_len == 0) {
+        conn_close(s, c);
+    }
+}
+
+static void accept_all(struct parta_server* s) {
+    while (1) {
+        int fd = accept4(s->listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            return;
+        }
+
+        struct srv_conn* c = calloc(1, sizeof(struct srv_conn));
+        if (c == NULL) {
+            close(fd);
+            continue;
+        }
+        c->fd = fd;
+        struct epoll_event ev = { .events = EPOLLIN, .data.ptr = c };
+        if (epoll_ctl(s->epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            close(fd);
+            free(c);
+            continue;
+        }
+        c->next = s->conns;
+        if (s->conns != NULL) {
+            s->conns->prev = c;
+        }
+        s->conns = c;
+    }
+}
+
+/** Hand completed jobs back to their connections. */
+static void deliver_done(struct parta_server* s) {
+    uint64_t count;
+    ssize_t n = read(s->wake_fd, &count, sizeof(count));
+    (void)n;
+
+    pthread_mutex_lock(&s->lock);
+    struct srv_job* job = queue_take_all(&s->done);
+    pthread_mutex_unlock(&s->lock);
+
+    while (job != NULL) {
+        struct srv_job* next = job->next;
+        struct srv_conn* c = job->conn;
+        c->inflight--;
+        if (c->closed) {
+            if (c->inflight == 0) {
+                conn_retire(s, c);
+            }
+        } else if (!conn_respond(c, &job->resp)) {
+            conn_close(s, c);
+        } else if (next == NULL || next->conn != c) {
+            // Batch consecutive responses to one connection into one write.
+            conn_flush(s, c);
+        }
+        job_free(job);
+        job = next;
+    }
+}
+
+/** Worker state: a preallocated PCB arena reused by every request */
+struct srv_worker {
+    struct parta_server* s;
+    pthread_t tid;
+    struct pcb* arena;
+    int cap;
+};
+
+static void worker_run_job(struct srv_worker* w, struct srv_job* job) {
+    struct srv_response* r = &job->resp;
+    r->req_id = job->req_id;
+    if (!job->valid) {
+        r->status = SRV_EALGO;
+        return;
+    }
+    if (job->plen == 0) {
+        r->status = SRV_OK;
+        return;
+    }
+
+    if (job->plen > w->cap) {
+        struct pcb* arena = realloc(w->arena, sizeof(struct pcb) * job->plen);
+        if (arena == NULL) {
+            r->status = SRV_ENOMEM;
+            return;
+        }
+        w->arena = arena;
+        w->cap = job->plen;
+    }
+
+    for (int i = 0; i < job->plen; i++) {
+        w->arena[i].pid = i;
+        w->arena[i].burst_left = job->payload[2 * i];
+        w->arena[i].wait = 0;
+        w->arena[i].priority = job->payload[2 * i + 1];
+    }
+
+    struct sched_result result;
+    if (!cache_sched_run(w->s->cache, &job->spec, w->arena, job->plen, w->arena, &result)) {
+        r->status = SRV_ENOMEM;
+        return;
+    }
+    r->status = SRV_OK;
+    r->total_time = result.total_time;
+    r->p99_wait = result.p99_wait;
+    r->avg_wait = result.avg_wait;
+}
+
+static void* worker_main(void* arg) {
+    struct srv_worker* w = arg;
+    struct parta_server* s = w->s;
+
+    pthread_mutex_lock(&s->lock);
+    while (1) {
+        while (s->todo.head == NULL && !s->stopping) {
+            pthread_cond_wait(&s->ready, &s->lock);
+        }
+        if (s->stopping) {
+            break;
+        }
+        struct srv_job* job = s->todo.head;
+        s->todo.head = job->next;
+        if (s->todo.head == NULL) {
+            s->todo.tail = NULL;
+        }
+        pthread_mutex_unlock(&s->lock);
+
+        worker_run_job(w, job);
+
+        pthread_mutex_lock(&s->lock);
+        bool was_empty = (s->done.head == NULL);
+        queue_push(&s->done, job);
+        if (was_empty) {
+            uint64_t one = 1;
+            ssize_t n = write(s->wake_fd, &one, sizeof(one));
+            (void)n;
+        }
+    }
+    pthread_mutex_unlock(&s->lock);
+    return NULL;
+}
+
+/**
+ * Serve requests until server_stop is called: an epoll loop on this
+ * thread reads and frames requests and writes responses, while
+ * s->threads workers run the simulations, each in its own
+ * preallocated PCB arena.
+ *
+ * Returns 0 on a clean stop, -1 if the server could not start.
+ */
+int server_run(struct parta_server* s) {
+    struct srv_worker* workers = calloc(s->threads, sizeof(struct srv_worker));
+    if (workers == NULL) {
+        return -1;
+    }
+
+    int started = 0;
+    for (int i = 0; i < s->threads; i++) {
+        workers[i].s = s;
+        workers[i].cap = s->arena_procs;
+        workers[i].arena = malloc(sizeof(struct pcb) * workers[i].cap);
+        if (workers[i].arena == NULL ||
+            pthread_create(&workers[i].tid, NULL, worker_main, &workers[i]) != 0) {
+            free(workers[i].arena);
+            break;
+        }
+        started++;
+    }
+
+    int rc = (started > 0) ? 0 : -1;
+    bool running = (started > 0);
+    struct epoll_event events[64];
+    while (running) {
+        int n = epoll_wait(s->epoll_fd, events, 64, -1);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0) {
+            rc = -1;
+            break;
+        }
+
+        for (int i = 0; i < n; i++) {
+            void* ptr = events[i].data.ptr;
+            if (ptr == &s->stop_fd) {
+                running = false;
+            } else if (ptr == &s->listen_fd) {
+                accept_all(s);
+            } else if (ptr == &s->wake_fd) {
+                deliver_done(s);
+            } else {
+                struct srv_conn* c = ptr;
+                if (c->closed) {
+                    // Closed earlier in this batch; its fd may already be reused.
+                    continue;
+                }
+                if (events[i].events & EPOLLOUT) {
+                    if (!conn_flush(s, c)) {
+                        continue;
+                    }
+                }
+                if (c->eof && (events[i].events & (EPOLLHUP | EPOLLERR))) {
+                    // Peer is gone entirely: nobody is left to answer.
+                    conn_close(s, c);
+                } else if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                    conn_read(s, c);
+                }
+            }
+        }
+        conn_reap(s);
+    }
+
+    pthread_mutex_lock(&s->lock);
+    s->stopping = true;
+    pthread_cond_broadcast(&s->ready);
+    pthread_mutex_unlock(&s->lock);
+    for (int i = 0; i < started; i++) {
+        pthread_join(workers[i].tid, NULL);
+        free(workers[i].arena);
+    }
+    free(workers);
+
+    // Workers are gone: drop unfinished jobs and every connection.
+    for (struct srv_job* job = queue_take_all(&s->todo); job != NULL;) {
+        struct srv_job* next = job->next;
+        job_free(job);
+        job = next;
+    }
+    for (struct srv_job* job = queue_take_all(&s->done); job != NULL;) {
+        struct srv_job* next = job->next;
+        job_free(job);
+        job = next;
+    }
+    while (s->conns != NULL) {
+        struct srv_conn* c = s->conns;
+        s->conns = c->next;
+        if (!c->closed) {
+            close(c->fd);
+        }
+        conn_free(c);
+    }
+    conn_reap(s);
+    return rc;
+}
+
+/**
+ * Close the server's descriptors and remove its socket file. The server
+ * must not be running.
+ */
+void server_free(struct parta_server* s) {
+    if (s == NULL) {
+        return;
+    }
+    int fds[] = { s->listen_fd, s->epoll_fd, s->wake_fd, s->stop_fd };
+    for (int i = 0; i < 4; i++) {
+        if (fds[i] >= 0) {
+            close(fds[i]);
+        }
+    }
+    if (s->listen_fd >= 0) {
+        unlink(s->path);
+    }
+    cache_free(s->cache);
+    pthread_mutex_destroy(&s->lock);
+    pthread_cond_destroy(&s->ready);
+    free(s);
+}
+
+/**
+ * Copy the counters of the server's result cache into *stats.
+ *
+ * Returns false if the server runs without a cache.
+ */
+bool server_cache_stats(struct parta_server* s, struct cache_stats* stats) {
+    if (s->cache == NULL) {
+        return false;
+    }
+    cache_stats(s->cache, stats);
+    return true;
+}
+
+/**
+ * Connect to a server listening on `path`.
+ *
+ * Returns the connected (blocking) socket, or -1 on failure.
+ */
+int srv_connect(const char* path) {
+    struct sockaddr_un addr = { 0 };
+    if (path == NULL || strlen(path) >= sizeof(addr.sun_path)) {
+        return -1;
+    }
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static bool write_all(int fd, const void* buf, size_t len) {
+    const unsigned char* p = buf;
+    while (len > 0) {
+        ssize_t n = send(fd, p, len, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+static bool read_all(int fd, void* buf, size_t len) {
+    unsigned char* p = buf;
+    while (len > 0) {
+        ssize_t n = read(fd, p, len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+/**
+ * Send one request frame. prios may be NULL (all priorities 0). The
+ * response is read separately with srv_recv, so several requests can be
+ * sent before reading any answers.
+ *
+ * Returns true if the whole frame was written.
+ */
+bool srv_send(int fd, const struct srv_request* req, const int* bursts, const int* prios) {
+    if (req == NULL || req->plen > SRV_MAX_PROCS || (req->plen > 0 && bursts == NULL)) {
+        return false;
+    }
+
+    size_t len = SRV_REQ_HEADER + 8 * (size_t)req->plen;
+    unsigned char* frame = malloc(4 + len);
+    if (frame == NULL) {
+        return false;
+    }
+
+    uint32_t len32 = (uint32_t)len;
+    memcpy(frame, &len32, 4);
+    memcpy(frame + 4, &req->req_id, 4);
+    memcpy(frame + 8, &req->param, 4);
+    memcpy(frame + 12, &req->plen, 4);
+    memcpy(frame + 16, req->algo, SRV_ALGO_LEN);
+    for (uint32_t i = 0; i < req->plen; i++) {
+        int32_t pair[2] = { bursts[i], (prios != NULL) ? prios[i] : 0 };
+        memcpy(frame + 4 + SRV_REQ_HEADER + 8 * (size_t)i, pair, 8);
+    }
+
+    bool ok = write_all(fd, frame, 4 + len);
+    free(frame);
+    return ok;
+}
+
+/**
+ * Read one response frame.
+ *
+ * Returns true on success, false on a closed or malformed stream.
+ */
+bool srv_recv(int fd, struct srv_response* resp) {
+    unsigned char frame[4 + SRV_RESP_BODY];
+    uint32_t len;
+    if (resp == NULL || !read_all(fd, frame, sizeof(frame))) {
+        return false;
+    }
+    memcpy(&len, frame, 4);
+    if (len != SRV_RESP_BODY) {
+        return false;
+    }
+    memcpy(&resp->req_id, frame + 4, 4);
+    memcpy(&resp->status, frame + 8, 4);
+    memcpy(&resp->total_time, frame + 12, 4);
+    memcpy(&resp->p99_wait, frame + 16, 4);
+    memcpy(&resp->avg_wait, frame + 20, 8);
+    return true;
+}
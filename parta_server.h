@@ -0,0 +1,74 @@
+#pragma once
+
+#include "parta_algo.h"
+#include "parta_cache.h"
+#include <stdint.h>
+
+/**
+ * Wire protocol of the simulation server. Every message is a frame: a
+ * uint32 body length followed by the body. Integers are in host byte
+ * order (the socket is local).
+ *
+ * Request body (SRV_REQ_HEADER bytes, then plen * 8 bytes):
+ *   uint32 req_id, int32 param, uint32 plen, char algo[SRV_ALGO_LEN],
+ *   then plen pairs of int32 (burst, priority)
+ *
+ * Response body (SRV_RESP_BODY bytes):
+ *   uint32 req_id, int32 status, int32 total_time, int32 p99_wait,
+ *   double avg_wait
+ *
+ * A connection may pipeline any number of requests; responses carry the
+ * req_id of their request and may come back in any order.
+ */
+#define SRV_ALGO_LEN 16
+#define SRV_REQ_HEADER (12 + SRV_ALGO_LEN)
+#define SRV_RESP_BODY 24
+
+/** Largest plen a request may carry */
+#define SRV_MAX_PROCS (1 << 22)
+
+/** Result of one request */
+enum srv_status {
+    SRV_OK = 0,       /** Ran successfully */
+    SRV_EALGO = 1,    /** Unknown algorithm or invalid parameter */
+    SRV_ENOMEM = 2,   /** Out of memory while running */
+};
+
+/** One request as sent by a client */
+struct srv_request {
+    uint32_t req_id;
+    char algo[SRV_ALGO_LEN]; /** Algorithm name, e.g. "rr" (NUL-padded) */
+    int32_t param;           /** Quantum, aging, ... (ignored if unused) */
+    uint32_t plen;           /** Number of processes */
+};
+
+/** One response as received by a client */
+struct srv_response {
+    uint32_t req_id;
+    int32_t status; /** enum srv_status */
+    int32_t total_time;
+    int32_t p99_wait;
+    double avg_wait;
+};
+
+/** Server settings */
+struct srv_config {
+    const char* path;      /** Unix socket path (replaced if it exists) */
+    int threads;           /** Worker threads, 0 for one per online CPU */
+    int arena_procs;       /** PCBs preallocated per worker, 0 for a default */
+    size_t cache_bytes;    /** Memory for memoized results, 0 disables the cache */
+    const char* cache_dir; /** On-disk result store, or NULL */
+};
+
+struct parta_server;
+
+
+struct parta_server* server_create(const struct srv_config* config);
+int server_run(struct parta_server* s);
+void server_stop(struct parta_server* s);
+void server_free(struct parta_server* s);
+bool server_cache_stats(struct parta_server* s, struct cache_stats* stats);
+
+int srv_connect(const char* path);
+bool srv_send(int fd, const struct srv_request* req, const int* bursts, const int* prios);
+bool srv_recv(int fd, struct srv_response* resp);
@@ -0,0 +1,246 @@
+#include "parta_share.h"
+#include <stdlib.h>
+
+/**
+ * State shared by the proportional-share schedulers: the original bursts
+ * (waits are settled lazily at completion) and the GPS reference clock
+ * used for the fairness error.
+ */
+struct share_run {
+    int* burst;      /* Original burst of each process */
+    int runnable;    /* Processes with burst_left > 0 */
+    long long total; /* Tickets held by runnable processes */
+    double gps;      /* Sum over slices of run_time / total */
+};
+
+static bool share_begin(struct share_run* s, struct pcb* procs, int plen, const int* tickets) {
+    s->burst = malloc(sizeof(int) * plen);
+    if (s->burst == NULL) {
+        return false;
+    }
+
+    s->runnable = 0;
+    s->total = 0;
+    s->gps = 0.0;
+    for (int i = 0; i < plen; i++) {
+        s->burst[i] = procs[i].burst_left;
+        if (procs[i].burst_left > 0) {
+            s->runnable++;
+            s->total += (tickets != NULL) ? tickets[i] : 1;
+        }
+    }
+    return true;
+}
+
+/**
+ * Account for a slice of `run_time` given to process `current`. Returns
+ * true if the process has just completed, in which case its wait (time
+ * spent runnable but not running) and fairness error are settled.
+ *
+ * The fairness error is (achieved - entitled) / finish, where entitled
+ * is the service an ideal GPS scheduler would have given the process up
+ * to its finish time: tickets * sum(run_time / runnable tickets).
+ */
+static bool share_account(struct share_run* s, struct pcb* procs, int current, int t,
+                          int run_time, int now, double* fair_err) {
+    s->gps += (double)run_time / s->total;
+    procs[current].burst_left -= run_time;
+    if (procs[current].burst_left > 0) {
+        return false;
+    }
+
+    procs[current].wait += now - s->burst[current];
+    if (fair_err != NULL) {
+        double entitled = t * s->gps;
+        fair_err[current] = (s->burst[current] - entitled) / now;
+    }
+    s->runnable--;
+    s->total -= t;
+    return true;
+}
+
+static void fenwick_add(long long* tree, int plen, int idx, long long delta) {
+    for (int i = idx + 1; i <= plen; i += i & -i) {
+        tree[i] += delta;
+    }
+}
+
+/** Smallest index whose prefix sum of tickets exceeds `target`. */
+static int fenwick_find(const long long* tree, int plen, long long target) {
+    int pos = 0;
+    int step = 1;
+    while (step * 2 <= plen) {
+        step *= 2;
+    }
+
+    for (; step > 0; step /= 2) {
+        if (pos + step <= plen && tree[pos + step] <= target) {
+            pos += step;
+            target -= tree[pos];
+        }
+    }
+    return pos;
+}
+
+static unsigned long long splitmix64(unsigned long long* state) {
+    unsigned long long z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static bool tickets_valid(const int* tickets, int plen) {
+    for (int i = 0; tickets != NULL && i < plen; i++) {
+        if (tickets[i] <= 0 || tickets[i] > STRIDE1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Run all processes using lottery scheduling. Each slice, a ticket is
+ * drawn uniformly from the runnable processes and its holder runs for
+ * min(quantum, burst_left). A Fenwick tree over tickets makes each draw
+ * and each removal O(log plen).
+ *
+ * tickets may be NULL (one ticket each). fair_err, if not NULL, receives
+ * each process' fairness error (see share_account); processes with no
+ * burst get 0.
+ *
+ * Returns the total time elapsed when all processes are complete.
+ */
+int lottery_run(struct pcb* procs, int plen, const int* tickets, int quantum,
+                unsigned long long seed, double* fair_err) {
+    if (procs == NULL || plen <= 0 || quantum <= 0 || !tickets_valid(tickets, plen)) {
+        return 0;
+    }
+
+    struct share_run s;
+    long long* tree = calloc(plen + 1, sizeof(long long));
+    if (tree == NULL || !share_begin(&s, procs, plen, tickets)) {
+        free(tree);
+        return 0;
+    }
+
+    for (int i = 0; i < plen; i++) {
+        if (fair_err != NULL) {
+            fair_err[i] = 0.0;
+        }
+        if (procs[i].burst_left > 0) {
+            fenwick_add(tree, plen, i, (tickets != NULL) ? tickets[i] : 1);
+        }
+    }
+
+    int total_time = 0;
+    while (s.runnable > 0) {
+        long long draw = (long long)(splitmix64(&seed) % (unsigned long long)s.total);
+        int current = fenwick_find(tree, plen, draw);
+        int t = (tickets != NULL) ? tickets[current] : 1;
+
+        int run_time = procs[current].burst_left;
+        if (quantum < run_time) {
+            run_time = quantum;
+        }
+        total_time += run_time;
+
+        if (share_account(&s, procs, current, t, run_time, total_time, fair_err)) {
+            fenwick_add(tree, plen, current, -t);
+        }
+    }
+
+    free(tree);
+    free(s.burst);
+    return total_time;
+}
+
+/** Heap entry for stride scheduling, ordered by (pass, pid) */
+struct stride_node {
+    long long pass;
+    int idx;
+};
+
+static bool stride_before(const struct stride_node* a, const struct stride_node* b) {
+    return (a->pass != b->pass) ? a->pass < b->pass : a->idx < b->idx;
+}
+
+static void stride_sift_down(struct stride_node* h, int len, int i) {
+    struct stride_node node = h[i];
+    while (1) {
+        int child = 2 * i + 1;
+        if (child >= len) {
+            break;
+        }
+        if (child + 1 < len && stride_before(&h[child + 1], &h[child])) {
+            child++;
+        }
+        if (!stride_before(&h[child], &node)) {
+            break;
+        }
+        h[i] = h[child];
+        i = child;
+    }
+    h[i] = node;
+}
+
+/**
+ * Run all processes using stride scheduling. The runnable process with
+ * the smallest pass runs for min(quantum, burst_left), then its pass
+ * advances by (STRIDE1 / tickets) per unit of time it ran. A binary heap
+ * on pass values makes each decision O(log plen).
+ *
+ * tickets and fair_err are as for lottery_run.
+ *
+ * Returns the total time elapsed when all processes are complete.
+ */
+int stride_run(struct pcb* procs, int plen, const int* tickets, int quantum,
+               double* fair_err) {
+    if (procs == NULL || plen <= 0 || quantum <= 0 || !tickets_valid(tickets, plen)) {
+        return 0;
+    }
+
+    struct share_run s;
+    struct stride_node* heap = malloc(sizeof(struct stride_node) * plen);
+    if (heap == NULL || !share_begin(&s, procs, plen, tickets)) {
+        free(heap);
+        return 0;
+    }
+
+    // Every pass starts at 0 and pids are in order, so this is a heap.
+    int len = 0;
+    for (int i = 0; i < plen; i++) {
+        if (fair_err != NULL) {
+            fair_err[i] = 0.0;
+        }
+        if (procs[i].burst_left > 0) {
+            heap[len].pass = 0;
+            heap[len].idx = i;
+            len++;
+        }
+    }
+
+    int total_time = 0;
+    while (len > 0) {
+        int current = heap[0].idx;
+        int t = (tickets != NULL) ? tickets[current] : 1;
+
+        int run_time = procs[current].burst_left;
+        if (quantum < run_time) {
+            run_time = quantum;
+        }
+        total_time += run_time;
+
+        if (share_account(&s, procs, current, t, run_time, total_time, fair_err)) {
+            heap[0] = heap[--len];
+        } else {
+            heap[0].pass += (long long)(STRIDE1 / t) * run_time;
+        }
+        if (len > 0) {
+            stride_sift_down(heap, len, 0);
+        }
+    }
+
+    free(heap);
+    free(s.burst);
+    return total_time;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "parta.h"
+
+/** Stride of a process holding a single ticket */
+#define STRIDE1 (1 << 20)
+
+
+int lottery_run(struct pcb* procs, int plen, const int* tickets, int quantum,
+                unsigned long long seed, double* fair_err);
+int stride_run(struct pcb* procs, int plen, const int* tickets, int quantum,
+               double* fair_err);
@@ -0,0 +1,131 @@
+#include "parta_sketch.h"
+#include <string.h>
+
+#define SKETCH_HALF (1 << (SKETCH_SUB_BITS - 1))
+
+void sketch_init(struct wait_sketch* s) {
+    memset(s, 0, sizeof(*s));
+}
+
+/**
+ * Bucket of v >= 0: v itself below 2^SKETCH_SUB_BITS, otherwise the top
+ * SKETCH_SUB_BITS bits of v offset by how far they were shifted.
+ */
+static int bucket_of(unsigned long long v) {
+    if (v < (1ull << SKETCH_SUB_BITS)) {
+        return (int)v;
+    }
+    int shift = 63 - __builtin_clzll(v) - SKETCH_SUB_BITS + 1;
+    return shift * SKETCH_HALF + (int)(v >> shift);
+}
+
+/** Largest value that falls in bucket idx. */
+static long long bucket_high(int idx) {
+    if (idx < (1 << SKETCH_SUB_BITS)) {
+        return idx;
+    }
+    int shift = idx / SKETCH_HALF - 1;
+    unsigned long long low = (unsigned long long)(idx - shift * SKETCH_HALF) << shift;
+    return (long long)(low + ((1ull << shift) - 1));
+}
+
+/** Add a value (negative values count as 0). O(1). */
+void sketch_add(struct wait_sketch* s, long long value) {
+    value = (value > 0) ? value : 0;
+    if (s->count == 0 || value < s->min) {
+        s->min = value;
+    }
+    if (s->count == 0 || value > s->max) {
+        s->max = value;
+    }
+    s->count++;
+    s->buckets[bucket_of((unsigned long long)value)]++;
+}
+
+/** Add every value of `from` into `into`. */
+void sketch_merge(struct wait_sketch* into, const struct wait_sketch* from) {
+    if (from->count == 0) {
+        return;
+    }
+    if (into->count == 0 || from->min < into->min) {
+        into->min = from->min;
+    }
+    if (into->count == 0 || from->max > into->max) {
+        into->max = from->max;
+    }
+    into->count += from->count;
+    for (int i = 0; i < SKETCH_BUCKETS; i++) {
+        into->buckets[i] += from->buckets[i];
+    }
+}
+
+/**
+ * Nearest-rank quantile q in [0, 1]: the ceil(q * count)-th smallest
+ * value, reported as the top of its bucket (capped at the maximum), so
+ * it is exact for small values and never below the true quantile.
+ *
+ * Returns 0 for an empty sketch.
+ */
+long long sketch_quantile(const struct wait_sketch* s, double q) {
+    if (s->count == 0) {
+        return 0;
+    }
+    double r = q * (double)s->count;
+    unsigned long long rank = (r > 0.0) ? (unsigned long long)r : 0;
+    if ((double)rank < r * (1.0 - 1e-12)) {
+        rank++;
+    }
+    rank = (rank < 1) ? 1 : (rank > s->count) ? s->count : rank;
+    unsigned long long seen = 0;
+    for (int i = 0; i < SKETCH_BUCKETS; i++) {
+        seen += s->buckets[i];
+        if (seen >= rank) {
+            long long high = bucket_high(i);
+            return (high < s->max) ? high : s->max;
+        }
+    }
+    return s->max;
+}
+
+void welford_init(struct welford* w) {
+    *w = (struct welford){ 0, 0.0, 0.0 };
+}
+
+/** Add one sample. O(1). */
+void welford_add(struct welford* w, double x) {
+    w->n++;
+    double delta = x - w->mean;
+    w->mean += delta / (double)w->n;
+    w->m2 += delta * (x - w->mean);
+}
+
+/** Add every sample of `from` into `into`. */
+void welford_merge(struct welford* into, const struct welford* from) {
+    if (from->n == 0) {
+        return;
+    }
+    long long n = into->n + from->n;
+    double delta = from->mean - into->mean;
+    into->mean += delta * (double)from->n / (double)n;
+    into->m2 += from->m2 + delta * delta * (double)into->n * (double)from->n / (double)n;
+    into->n = n;
+}
+
+/** Sample variance, 0 below two samples. */
+double welford_variance(const struct welford* w) {
+    return (w->n > 1) ? w->m2 / (double)(w->n - 1) : 0.0;
+}
+
+/** Half-width of the normal 95% confidence interval of the mean. */
+double welford_ci95(const struct welford* w) {
+    if (w->n < 2) {
+        return 0.0;
+    }
+    // sqrt by Newton's method, to stay free of libm.
+    double x = 1.96 * 1.96 * welford_variance(w) / (double)w->n;
+    double r = (x > 1.0) ? x : 1.0;
+    for (int i = 0; i < 64 && x > 0.0; i++) {
+        r = 0.5 * (r + x / r);
+    }
+    return (x > 0.0) ? r : 0.0;
+}
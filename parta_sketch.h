@@ -0,0 +1,41 @@
+#pragma once
+
+/**
+ * Fixed-size log-bucket histogram of non-negative values (waits). Values
+ * below 2^SKETCH_SUB_BITS get a bucket each; above that, every power of
+ * two is split into 2^(SKETCH_SUB_BITS - 1) buckets, so a quantile is
+ * off by less than 2^-(SKETCH_SUB_BITS - 1) (0.8%) of the true value.
+ * Memory does not depend on how many values are added, and two sketches
+ * merge by adding their buckets.
+ */
+#define SKETCH_SUB_BITS 8
+#define SKETCH_BUCKETS ((64 - SKETCH_SUB_BITS + 2) << (SKETCH_SUB_BITS - 1))
+
+struct wait_sketch {
+    unsigned long long count; /** Values added */
+    long long min;            /** Smallest value added (exact) */
+    long long max;            /** Largest value added (exact) */
+    unsigned long long buckets[SKETCH_BUCKETS];
+};
+
+/**
+ * Running mean and variance (Welford). Two summaries of disjoint samples
+ * merge exactly (Chan et al.), so each thread can keep its own.
+ */
+struct welford {
+    long long n; /** Samples added */
+    double mean;
+    double m2;   /** Sum of squared deviations from the mean */
+};
+
+
+void sketch_init(struct wait_sketch* s);
+void sketch_add(struct wait_sketch* s, long long value);
+void sketch_merge(struct wait_sketch* into, const struct wait_sketch* from);
+long long sketch_quantile(const struct wait_sketch* s, double q);
+
+void welford_init(struct welford* w);
+void welford_add(struct welford* w, double x);
+void welford_merge(struct welford* into, const struct welford* from);
+double welford_variance(const struct welford* w);
+double welford_ci95(const struct welford* w);
@@ -0,0 +1,586 @@
+#include "parta_smp.h"
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define SMP_NEVER LLONG_MAX
+
+enum smp_kind {
+    SMP_REQUEST, /* "Send me a process" */
+    SMP_MIGRATE, /* The process `pid`, taken off the sender's runqueue */
+    SMP_REFUSE,  /* Nothing is waiting here */
+};
+
+struct smp_msg {
+    long long time; /* Arrival */
+    long long seq;  /* Send order at the sender */
+    int src;
+    int kind;
+    int pid;
+    struct smp_msg* next; /* Mailbox link */
+};
+
+/**
+ * One simulated CPU. In the parallel run a CPU is only touched by the
+ * host thread that owns it, except for `mailbox`, where other threads
+ * push messages.
+ */
+struct smp_cpu {
+    int head;            /* Runqueue through smp_sim.next/prev, -1 if empty */
+    int tail;
+    int waiting;         /* Processes on the runqueue */
+    int running;         /* -1 when idle */
+    int slice;           /* Length of the running slice */
+    long long slice_end;
+    long long seq;       /* Messages sent so far */
+    int probe;           /* Offset of the next CPU to ask, 1 .. cpus - 1 */
+    int refusals;        /* Refusals in a row */
+    bool asking;         /* A request is on its way */
+    bool done_asking;    /* Every other CPU refused */
+    bool failed;         /* A message could not be allocated */
+    long long steals;
+    long long messages;
+    struct smp_msg** inbox; /* Binary heap by (time, src, seq) */
+    int ninbox;
+    int capinbox;
+    struct smp_msg* mailbox __attribute__((aligned(64))); /* Treiber stack */
+} __attribute__((aligned(64)));
+
+/** Entry of the sequential run's queue of CPUs by next event time */
+struct smp_slot {
+    long long time;
+    int cpu;
+};
+
+struct smp_sim {
+    const struct smp_config* config;
+    struct pcb* procs;
+    int plen;
+    int* next;
+    int* prev;
+    int* burst;          /* Burst of each pid at the start */
+    long long* finish;
+    struct smp_cpu* cpus;
+    bool parallel;
+    struct smp_slot* ready; /* Sequential run only: lazy heap, may hold stale slots */
+    int nready;
+    int capready;
+};
+
+static bool msg_before(const struct smp_msg* a, const struct smp_msg* b) {
+    if (a->time != b->time) {
+        return a->time < b->time;
+    }
+    return (a->src != b->src) ? a->src < b->src : a->seq < b->seq;
+}
+
+static bool inbox_push(struct smp_cpu* cpu, struct smp_msg* m) {
+    if (cpu->ninbox == cpu->capinbox) {
+        int cap = (cpu->capinbox > 0) ? cpu->capinbox * 2 : 8;
+        struct smp_msg** grown = realloc(cpu->inbox, sizeof(struct smp_msg*) * cap);
+        if (grown == NULL) {
+            return false;
+        }
+        cpu->inbox = grown;
+        cpu->capinbox = cap;
+    }
+    int i = cpu->ninbox++;
+    while (i > 0 && msg_before(m, cpu->inbox[(i - 1) / 2])) {
+        cpu->inbox[i] = cpu->inbox[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    cpu->inbox[i] = m;
+    return true;
+}
+
+static struct smp_msg* inbox_pop(struct smp_cpu* cpu) {
+    struct smp_msg* top = cpu->inbox[0];
+    struct smp_msg* last = cpu->inbox[--cpu->ninbox];
+    int i = 0;
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= cpu->ninbox) {
+            break;
+        }
+        if (child + 1 < cpu->ninbox && msg_before(cpu->inbox[child + 1], cpu->inbox[child])) {
+            child++;
+        }
+        if (!msg_before(cpu->inbox[child], last)) {
+            break;
+        }
+        cpu->inbox[i] = cpu->inbox[child];
+        i = child;
+    }
+    if (cpu->ninbox > 0) {
+        cpu->inbox[i] = last;
+    }
+    return top;
+}
+
+static bool slot_before(struct smp_slot a, struct smp_slot b) {
+    return (a.time != b.time) ? a.time < b.time : a.cpu < b.cpu;
+}
+
+static bool ready_push(struct smp_sim* sim, long long time, int cpu) {
+    if (sim->nready == sim->capready) {
+        int cap = (sim->capready > 0) ? sim->capready * 2 : 64;
+        struct smp_slot* grown = realloc(sim->ready, sizeof(struct smp_slot) * cap);
+        if (grown == NULL) {
+            return false;
+        }
+        sim->ready = grown;
+        sim->capready = cap;
+    }
+    struct smp_slot slot = { time, cpu };
+    int i = sim->nready++;
+    while (i > 0 && slot_before(slot, sim->ready[(i - 1) / 2])) {
+        sim->ready[i] = sim->ready[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    sim->ready[i] = slot;
+    return true;
+}
+
+static struct smp_slot ready_pop(struct smp_sim* sim) {
+    struct smp_slot top = sim->ready[0];
+    struct smp_slot last = sim->ready[--sim->nready];
+    int i = 0;
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= sim->nready) {
+            break;
+        }
+        if (child + 1 < sim->nready && slot_before(sim->ready[child + 1], sim->ready[child])) {
+            child++;
+        }
+        if (!slot_before(sim->ready[child], last)) {
+            break;
+        }
+        sim->ready[i] = sim->ready[child];
+        i = child;
+    }
+    if (sim->nready > 0) {
+        sim->ready[i] = last;
+    }
+    return top;
+}
+
+static void rq_push(struct smp_sim* sim, struct smp_cpu* cpu, int pid) {
+    sim->next[pid] = -1;
+    sim->prev[pid] = cpu->tail;
+    if (cpu->tail >= 0) {
+        sim->next[cpu->tail] = pid;
+    } else {
+        cpu->head = pid;
+    }
+    cpu->tail = pid;
+    cpu->waiting++;
+}
+
+static void rq_remove(struct smp_sim* sim, struct smp_cpu* cpu, int pid) {
+    if (sim->prev[pid] >= 0) {
+        sim->next[sim->prev[pid]] = sim->next[pid];
+    } else {
+        cpu->head = sim->next[pid];
+    }
+    if (sim->next[pid] >= 0) {
+        sim->prev[sim->next[pid]] = sim->prev[pid];
+    } else {
+        cpu->tail = sim->prev[pid];
+    }
+    cpu->waiting--;
+}
+
+/**
+ * Send a message from CPU src, arriving `latency` after `now`: straight
+ * into the receiver's inbox in the sequential run, onto its mailbox in
+ * the parallel one.
+ */
+static void send(struct smp_sim* sim, int src, int dst, int kind, int pid, long long now) {
+    struct smp_cpu* from = &sim->cpus[src];
+    struct smp_msg* m = malloc(sizeof(struct smp_msg));
+    if (m == NULL) {
+        from->failed = true;
+        return;
+    }
+    *m = (struct smp_msg){ now + sim->config->latency, from->seq++, src, kind, pid, NULL };
+    from->messages++;
+
+    struct smp_cpu* to = &sim->cpus[dst];
+    if (sim->parallel) {
+        struct smp_msg* head = __atomic_load_n(&to->mailbox, __ATOMIC_RELAXED);
+        do {
+            m->next = head;
+        } while (!__atomic_compare_exchange_n(&to->mailbox, &head, m, true, __ATOMIC_RELEASE,
+                                              __ATOMIC_RELAXED));
+    } else if (!inbox_push(to, m)) {
+        free(m);
+        from->failed = true;
+    } else if (!ready_push(sim, m->time, dst)) {
+        from->failed = true;
+    }
+}
+
+/** Start the next slice if idle, or ask the next CPU for work. */
+static void dispatch(struct smp_sim* sim, int id, long long now) {
+    struct smp_cpu* cpu = &sim->cpus[id];
+    if (cpu->running >= 0) {
+        return;
+    }
+    if (cpu->head >= 0) {
+        int pid = cpu->head;
+        rq_remove(sim, cpu, pid);
+        int left = sim->procs[pid].burst_left;
+        cpu->running = pid;
+        cpu->slice = (left < sim->config->quantum) ? left : sim->config->quantum;
+        cpu->slice_end = now + cpu->slice;
+    } else if (!cpu->asking && !cpu->done_asking && sim->config->cpus > 1) {
+        send(sim, id, (id + cpu->probe) % sim->config->cpus, SMP_REQUEST, -1, now);
+        cpu->asking = true;
+    }
+}
+
+static long long next_time(const struct smp_cpu* cpu) {
+    long long slice = (cpu->running >= 0) ? cpu->slice_end : SMP_NEVER;
+    long long msg = (cpu->ninbox > 0) ? cpu->inbox[0]->time : SMP_NEVER;
+    return (msg <= slice) ? msg : slice;
+}
+
+/** Run the earliest event of CPU id. */
+static void step(struct smp_sim* sim, int id) {
+    struct smp_cpu* cpu = &sim->cpus[id];
+    int cpus = sim->config->cpus;
+    if (cpu->ninbox > 0 && (cpu->running < 0 || cpu->inbox[0]->time <= cpu->slice_end)) {
+        struct smp_msg* m = inbox_pop(cpu);
+        long long now = m->time;
+        if (m->kind == SMP_REQUEST) {
+            if (cpu->waiting > 0) {
+                int pid = cpu->tail;
+                rq_remove(sim, cpu, pid);
+                send(sim, id, m->src, SMP_MIGRATE, pid, now);
+            } else {
+                send(sim, id, m->src, SMP_REFUSE, -1, now);
+            }
+        } else if (m->kind == SMP_MIGRATE) {
+            cpu->asking = false;
+            cpu->refusals = 0;
+            cpu->steals++;
+            rq_push(sim, cpu, m->pid);
+            dispatch(sim, id, now);
+        } else {
+            cpu->asking = false;
+            cpu->probe = cpu->probe % (cpus - 1) + 1;
+            cpu->done_asking = ++cpu->refusals >= cpus - 1;
+            dispatch(sim, id, now);
+        }
+        free(m);
+        return;
+    }
+
+    long long now = cpu->slice_end;
+    int pid = cpu->running;
+    sim->procs[pid].burst_left -= cpu->slice;
+    if (sim->procs[pid].burst_left == 0) {
+        sim->finish[pid] = now;
+    } else {
+        rq_push(sim, cpu, pid);
+    }
+    cpu->running = -1;
+    dispatch(sim, id, now);
+}
+
+static void sim_free(struct smp_sim* sim) {
+    for (int c = 0; sim->cpus != NULL && c < sim->config->cpus; c++) {
+        struct smp_cpu* cpu = &sim->cpus[c];
+        for (int i = 0; i < cpu->ninbox; i++) {
+            free(cpu->inbox[i]);
+        }
+        for (struct smp_msg* m = cpu->mailbox; m != NULL;) {
+            struct smp_msg* next = m->next;
+            free(m);
+            m = next;
+        }
+        free(cpu->inbox);
+    }
+    free(sim->cpus);
+    free(sim->next);
+    free(sim->prev);
+    free(sim->burst);
+    free(sim->finish);
+    free(sim->ready);
+}
+
+/**
+ * Set up the model: process pid queued on CPU pid % cpus, then every
+ * CPU dispatched at time 0 (the empty ones send their first request).
+ *
+ * Returns false on bad arguments or allocation failure.
+ */
+static bool sim_init(struct smp_sim* sim, struct pcb* procs, int plen,
+                     const struct smp_config* config, bool parallel) {
+    *sim = (struct smp_sim){ 0 };
+    sim->config = config;
+    sim->procs = procs;
+    sim->plen = plen;
+    sim->parallel = parallel;
+    if (procs == NULL || plen <= 0 || config == NULL || config->cpus <= 0 ||
+        config->quantum <= 0 || config->latency <= 0) {
+        return false;
+    }
+
+    sim->next = malloc(sizeof(int) * plen);
+    sim->prev = malloc(sizeof(int) * plen);
+    sim->burst = malloc(sizeof(int) * plen);
+    sim->finish = malloc(sizeof(long long) * plen);
+    sim->cpus = aligned_alloc(64, sizeof(struct smp_cpu) * config->cpus);
+    if (sim->next == NULL || sim->prev == NULL || sim->burst == NULL || sim->finish == NULL ||
+        sim->cpus == NULL) {
+        free(sim->cpus);
+        sim->cpus = NULL;
+        return false;
+    }
+    for (int c = 0; c < config->cpus; c++) {
+        sim->cpus[c] = (struct smp_cpu){ 0 };
+        sim->cpus[c].head = sim->cpus[c].tail = sim->cpus[c].running = -1;
+        sim->cpus[c].probe = 1;
+    }
+    for (int i = 0; i < plen; i++) {
+        sim->burst[i] = procs[i].burst_left;
+        sim->finish[i] = 0;
+        if (procs[i].burst_left > 0) {
+            rq_push(sim, &sim->cpus[i % config->cpus], i);
+        }
+    }
+    for (int c = 0; c < config->cpus; c++) {
+        dispatch(sim, c, 0);
+    }
+    return true;
+}
+
+/**
+ * Collect the waits into the PCBs and the totals into *stats.
+ *
+ * Returns false if a message was lost to an allocation failure.
+ */
+static bool sim_finish(struct smp_sim* sim, struct smp_stats* stats) {
+    struct smp_stats st = { 0, 0, 0, (stats != NULL) ? stats->epochs : 0 };
+    bool ok = true;
+    for (int c = 0; c < sim->config->cpus; c++) {
+        ok = ok && !sim->cpus[c].failed;
+        st.steals += sim->cpus[c].steals;
+        st.messages += sim->cpus[c].messages;
+    }
+    for (int i = 0; i < sim->plen; i++) {
+        if (sim->burst[i] > 0) {
+            sim->procs[i].wait += (int)(sim->finish[i] - sim->burst[i]);
+            st.total_time = (sim->finish[i] > st.total_time) ? sim->finish[i] : st.total_time;
+        }
+    }
+    if (stats != NULL) {
+        *stats = st;
+    }
+    return ok;
+}
+
+/**
+ * Run the multi-CPU model (see parta_smp.h) as a sequential
+ * discrete-event simulation: CPUs are stepped in order of their next
+ * event from one heap.
+ *
+ * Returns true on success.
+ */
+bool smp_run(struct pcb* procs, int plen, const struct smp_config* config,
+             struct smp_stats* stats) {
+    struct smp_sim sim;
+    bool ok = sim_init(&sim, procs, plen, config, false);
+    for (int c = 0; ok && c < config->cpus; c++) {
+        long long t = next_time(&sim.cpus[c]);
+        ok = (t == SMP_NEVER) || ready_push(&sim, t, c);
+    }
+
+    while (ok && sim.nready > 0) {
+        struct smp_slot slot = ready_pop(&sim);
+        if (next_time(&sim.cpus[slot.cpu]) != slot.time) {
+            continue; // Stale: the CPU already ran that event
+        }
+        step(&sim, slot.cpu);
+        long long t = next_time(&sim.cpus[slot.cpu]);
+        ok = (t == SMP_NEVER) || ready_push(&sim, t, slot.cpu);
+    }
+
+    if (stats != NULL) {
+        stats->epochs = 0;
+    }
+    ok = ok && sim_finish(&sim, stats);
+    sim_free(&sim);
+    return ok;
+}
+
+/** Sense-reversing barrier that spins briefly, then yields */
+struct smp_barrier {
+    int count;
+    int arrived;
+    int sense;
+};
+
+static void barrier_wait(struct smp_barrier* b, int* local_sense) {
+    int sense = !*local_sense;
+    *local_sense = sense;
+    if (__atomic_add_fetch(&b->arrived, 1, __ATOMIC_ACQ_REL) == b->count) {
+        __atomic_store_n(&b->arrived, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&b->sense, sense, __ATOMIC_RELEASE);
+        return;
+    }
+    for (int spins = 0; __atomic_load_n(&b->sense, __ATOMIC_ACQUIRE) != sense; spins++) {
+        if (spins > 256) {
+            sched_yield();
+        }
+    }
+}
+
+/** State shared by the threads of one smp_run_parallel */
+struct smp_par {
+    struct smp_sim* sim;
+    struct smp_barrier barrier;
+    pthread_mutex_t gate; /* Held while the threads are being started */
+    int nthreads;
+    long long* minima;    /* Two rounds of per-thread next event times */
+    long long epochs;
+};
+
+struct smp_worker {
+    struct smp_par* par;
+    int id;
+};
+
+/**
+ * One host thread: owns CPUs [id * cpus / n, (id + 1) * cpus / n). Each
+ * epoch it moves the messages from its CPUs' mailboxes into their
+ * inboxes, agrees with the other threads on the earliest pending event
+ * T, and runs every event of its CPUs before T + latency. Nothing sent
+ * in the epoch can arrive before that, so no CPU waits on another
+ * within it.
+ */
+static void* smp_thread(void* arg) {
+    struct smp_worker* w = arg;
+    struct smp_par* par = w->par;
+    struct smp_sim* sim = par->sim;
+    pthread_mutex_lock(&par->gate);
+    pthread_mutex_unlock(&par->gate);
+
+    int n = par->nthreads;
+    int lo = (int)((long long)w->id * sim->config->cpus / n);
+    int hi = (int)((long long)(w->id + 1) * sim->config->cpus / n);
+    int sense = 0;
+    for (int round = 0;; round ^= 1) {
+        long long local = SMP_NEVER;
+        for (int c = lo; c < hi; c++) {
+            struct smp_cpu* cpu = &sim->cpus[c];
+            struct smp_msg* m = __atomic_exchange_n(&cpu->mailbox, NULL, __ATOMIC_ACQUIRE);
+            while (m != NULL) {
+                struct smp_msg* next = m->next;
+                if (!inbox_push(cpu, m)) {
+                    cpu->failed = true;
+                    free(m);
+                }
+                m = next;
+            }
+            long long t = next_time(cpu);
+            local = (t < local) ? t : local;
+        }
+        par->minima[round * n + w->id] = local;
+        barrier_wait(&par->barrier, &sense);
+
+        long long start = SMP_NEVER;
+        for (int t = 0; t < n; t++) {
+            long long m = par->minima[round * n + t];
+            start = (m < start) ? m : start;
+        }
+        if (start == SMP_NEVER) {
+            return NULL;
+        }
+        long long end = start + sim->config->latency;
+        for (int c = lo; c < hi; c++) {
+            while (next_time(&sim->cpus[c]) < end) {
+                step(sim, c);
+            }
+        }
+        if (w->id == 0) {
+            par->epochs++;
+        }
+        barrier_wait(&par->barrier, &sense);
+    }
+}
+
+/**
+ * Run the same model as smp_run as a parallel discrete-event simulation
+ * on up to `threads` host threads (<= 0 for one per CPU of the host),
+ * each owning a contiguous block of simulated CPUs. Messages cross
+ * between threads through lock-free mailboxes (one Treiber stack per
+ * CPU), and epochs of `latency` ticks are separated by barriers.
+ *
+ * The waits and stats match smp_run exactly, apart from stats->epochs.
+ *
+ * Returns true on success.
+ */
+bool smp_run_parallel(struct pcb* procs, int plen, const struct smp_config* config,
+                      int threads, struct smp_stats* stats) {
+    struct smp_sim sim;
+    if (!sim_init(&sim, procs, plen, config, true)) {
+        sim_free(&sim);
+        return false;
+    }
+    if (threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 0) ? (int)cpus : 1;
+    }
+    threads = (threads < config->cpus) ? threads : config->cpus;
+
+    struct smp_par par = { 0 };
+    par.sim = &sim;
+    struct smp_worker* workers = malloc(sizeof(struct smp_worker) * threads);
+    pthread_t* tids = malloc(sizeof(pthread_t) * threads);
+    par.minima = malloc(sizeof(long long) * 2 * threads);
+    if (workers == NULL || tids == NULL || par.minima == NULL) {
+        free(workers);
+        free(tids);
+        free(par.minima);
+        sim_free(&sim);
+        return false;
+    }
+
+    // The workers wait at the gate until the thread count is final; if
+    // a thread cannot be started the CPUs are split among fewer.
+    pthread_mutex_init(&par.gate, NULL);
+    pthread_mutex_lock(&par.gate);
+    int started = 0;
+    for (int t = 1; t < threads; t++) {
+        workers[started + 1] = (struct smp_worker){ &par, started + 1 };
+        if (pthread_create(&tids[started], NULL, smp_thread, &workers[started + 1]) != 0) {
+            break;
+        }
+        started++;
+    }
+    par.nthreads = started + 1;
+    par.barrier.count = started + 1;
+    workers[0] = (struct smp_worker){ &par, 0 };
+    pthread_mutex_unlock(&par.gate);
+
+    smp_thread(&workers[0]);
+    for (int t = 0; t < started; t++) {
+        pthread_join(tids[t], NULL);
+    }
+    pthread_mutex_destroy(&par.gate);
+
+    if (stats != NULL) {
+        stats->epochs = par.epochs;
+    }
+    bool ok = sim_finish(&sim, stats);
+    free(workers);
+    free(tids);
+    free(par.minima);
+    sim_free(&sim);
+    return ok;
+}
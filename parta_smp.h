@@ -0,0 +1,43 @@
+#pragma once
+
+#include "parta.h"
+
+/**
+ * Multi-CPU Round-Robin with work stealing. Every process arrives at
+ * time 0 and starts on CPU pid % cpus, which runs its own FIFO runqueue
+ * with the given quantum. A CPU whose runqueue runs dry asks one other
+ * CPU at a time (cpu + 1, cpu + 2, ...) for work: the victim hands over
+ * the process at the tail of its runqueue, or refuses if none is
+ * waiting. After a refusal from every other CPU it stops asking, since
+ * no runqueue can grow again.
+ *
+ * Requests, migrations and refusals take `latency` ticks to arrive,
+ * which is the lookahead of the parallel run: what a CPU does before
+ * T + latency cannot depend on another CPU after T. smp_run_parallel
+ * exploits it with conservative epochs of that length.
+ *
+ * Events of one CPU at the same time run messages first, in (sender,
+ * send order), then the end of the current slice, so both runs give the
+ * same result.
+ */
+
+/** Parameters of the multi-CPU model */
+struct smp_config {
+    int cpus;    /** Simulated CPUs */
+    int quantum; /** Round-Robin quantum on every CPU */
+    int latency; /** Ticks for a message between CPUs, at least 1 */
+};
+
+/** Outcome of a multi-CPU run besides the waits */
+struct smp_stats {
+    long long total_time; /** Time when the last process completed */
+    long long steals;     /** Processes migrated */
+    long long messages;   /** Requests, migrations and refusals sent */
+    long long epochs;     /** Synchronization rounds (smp_run_parallel only) */
+};
+
+
+bool smp_run(struct pcb* procs, int plen, const struct smp_config* config,
+             struct smp_stats* stats);
+bool smp_run_parallel(struct pcb* procs, int plen, const struct smp_config* config,
+                      int threads, struct smp_stats* stats);
@@ -0,0 +1,168 @@
+#include "parta_stream.h"
+#include <stdlib.h>
+#include <limits.h>
+#include <errno.h>
+#include <unistd.h>
+
+/** Bytes read per read(2) */
+#define STREAM_READ_SIZE (1 << 20)
+
+/** Per-process output is written once this much is buffered */
+#define STREAM_FLUSH_SIZE (1 << 20)
+
+void fcfs_stream_init(struct fcfs_stream* s) {
+    s->n = 0;
+    s->clock = 0;
+    s->sum_wait = 0;
+    sketch_init(&s->waits);
+}
+
+/**
+ * Run the next process to completion, as fcfs_run would: a positive
+ * burst waits for the clock so far, anything else waits 0.
+ *
+ * Returns the process' wait.
+ */
+long long fcfs_stream_push(struct fcfs_stream* s, int burst) {
+    long long wait = (burst > 0) ? s->clock : 0;
+    if (burst > 0) {
+        s->clock += burst;
+    }
+    s->n++;
+    s->sum_wait += (unsigned long long)wait;
+    sketch_add(&s->waits, wait);
+    return wait;
+}
+
+/** Mean wait over every process seen (0 if none). */
+double fcfs_stream_avg_wait(const struct fcfs_stream* s) {
+    return (s->n > 0) ? (double)s->sum_wait / (double)s->n : 0.0;
+}
+
+/**
+ * Append "<pid> <wait>\n" to `out`, writing the buffer out once it holds
+ * STREAM_FLUSH_SIZE bytes, so per-process output needs constant memory.
+ *
+ * Returns false if the write failed.
+ */
+bool stream_write_wait(struct out_buf* out, long long pid, long long wait) {
+    out_ll(out, pid);
+    out_char(out, ' ');
+    out_ll(out, wait);
+    out_char(out, '\n');
+    return out->len < STREAM_FLUSH_SIZE || out_flush(out);
+}
+
+/** Start reading bursts from fd. Returns false if out of memory. */
+bool burst_reader_init(struct burst_reader* r, int fd) {
+    r->fd = fd;
+    r->buf = malloc(STREAM_READ_SIZE);
+    r->pos = 0;
+    r->len = 0;
+    r->eof = false;
+    r->count = 0;
+    r->status = (r->buf != NULL) ? STREAM_OK : STREAM_ENOMEM;
+    return r->buf != NULL;
+}
+
+void burst_reader_free(struct burst_reader* r) {
+    free(r->buf);
+    r->buf = NULL;
+}
+
+/**
+ * Parse the next burst. Bursts are non-negative decimal ints separated
+ * by whitespace or commas; numbers may span read boundaries, so nothing
+ * but the current number is kept.
+ *
+ * Returns true and stores it in *burst, or false at end of input
+ * (r->status is STREAM_OK) or on error (r->status says why, and
+ * r->count is the pid of a bad burst).
+ */
+bool burst_reader_next(struct burst_reader* r, int* burst) {
+    if (r->status != STREAM_OK) {
+        return false;
+    }
+
+    bool in_token = false;
+    bool bad = false;
+    long long value = 0;
+    for (;;) {
+        if (r->pos == r->len) {
+            if (r->eof) {
+                break;
+            }
+            ssize_t got = read(r->fd, r->buf, STREAM_READ_SIZE);
+            if (got < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                r->status = STREAM_EREAD;
+                return false;
+            }
+            r->pos = 0;
+            r->len = (size_t)got;
+            r->eof = (got == 0);
+            continue;
+        }
+
+        char c = r->buf[r->pos++];
+        if (c >= '0' && c <= '9') {
+            if (!bad) {
+                value = value * 10 + (c - '0');
+                bad = value > INT_MAX;
+            }
+            in_token = true;
+        } else if (c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == ',') {
+            if (in_token) {
+                break;
+            }
+        } else {
+            // Signs, letters, ...: the whole token is invalid.
+            in_token = true;
+            bad = true;
+        }
+    }
+
+    if (!in_token) {
+        return false;
+    }
+    if (bad) {
+        r->status = STREAM_EINPUT;
+        return false;
+    }
+    *burst = (int)value;
+    r->count++;
+    return true;
+}
+
+/**
+ * Read bursts from in_fd until end of input and push each one. With
+ * `out`, each process' "<pid> <wait>" line is written as it is computed.
+ *
+ * Returns STREAM_OK, or why it stopped (for STREAM_EINPUT, s->n is the
+ * pid of the bad burst).
+ */
+enum stream_status fcfs_stream_fd(struct fcfs_stream* s, int in_fd, struct out_buf* out) {
+    struct burst_reader r;
+    if (!burst_reader_init(&r, in_fd)) {
+        return STREAM_ENOMEM;
+    }
+
+    int burst;
+    enum stream_status status = STREAM_OK;
+    while (status == STREAM_OK && burst_reader_next(&r, &burst)) {
+        long long pid = s->n;
+        long long wait = fcfs_stream_push(s, burst);
+        if (out != NULL && !stream_write_wait(out, pid, wait)) {
+            status = STREAM_EWRITE;
+        }
+    }
+    status = (status == STREAM_OK) ? r.status : status;
+    burst_reader_free(&r);
+
+    if (status == STREAM_OK && out != NULL && !out_flush(out)) {
+        status = STREAM_EWRITE;
+    }
+    return status;
+}
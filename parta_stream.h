@@ -0,0 +1,49 @@
+#pragma once
+
+#include "parta_cli.h"
+#include "parta_sketch.h"
+
+/**
+ * Streaming FCFS. Every process arrives at time 0 in input order, so its
+ * wait is the sum of the earlier bursts: a run only needs that running
+ * sum, the wait total and a quantile sketch, whatever the number of
+ * processes. Counters are 64-bit (the wait total 128-bit).
+ */
+struct fcfs_stream {
+    long long n;                  /** Processes seen (the next pid) */
+    long long clock;              /** Sum of positive bursts so far */
+    unsigned __int128 sum_wait;   /** Sum of all waits */
+    struct wait_sketch waits;     /** Distribution of the waits */
+};
+
+/** How fcfs_stream_fd finished */
+enum stream_status {
+    STREAM_OK = 0,     /** Reached end of input */
+    STREAM_EINPUT = 1, /** Burst n is not a non-negative int */
+    STREAM_EREAD = 2,  /** read(2) failed */
+    STREAM_EWRITE = 3, /** Writing per-process results failed */
+    STREAM_ENOMEM = 4, /** Could not allocate the read buffer */
+    STREAM_ETMP = 5,   /** Creating, writing or reading a spill file failed */
+};
+
+/** Pull parser for a text stream of bursts */
+struct burst_reader {
+    int fd;
+    char* buf;
+    size_t pos;                /** Next byte of buf to parse */
+    size_t len;                /** Bytes in buf */
+    bool eof;
+    long long count;           /** Bursts returned so far */
+    enum stream_status status; /** STREAM_OK until an error stops the reader */
+};
+
+
+bool burst_reader_init(struct burst_reader* r, int fd);
+bool burst_reader_next(struct burst_reader* r, int* burst);
+void burst_reader_free(struct burst_reader* r);
+bool stream_write_wait(struct out_buf* out, long long pid, long long wait);
+
+void fcfs_stream_init(struct fcfs_stream* s);
+long long fcfs_stream_push(struct fcfs_stream* s, int burst);
+double fcfs_stream_avg_wait(const struct fcfs_stream* s);
+enum stream_status fcfs_stream_fd(struct fcfs_stream* s, int in_fd, struct out_buf* out);
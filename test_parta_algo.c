@@ -0,0 +1,151 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_algo.h"
+#include <stdlib.h> // For malloc/free
+#include <string.h>
+
+void setUp(void) {
+    // Code to execute at test start up
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+}
+
+void test_sjf_run(void) {
+    // Given
+    int bursts[] = { 5, 8, 2, 5 };
+    struct pcb* procs = init_procs(bursts, 4);
+
+    // When: order is P2, P0, P3, P1
+    int total = sjf_run(procs, 4);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(20, total);
+    TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(12, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].wait);
+    TEST_ASSERT_EQUAL_INT(7, procs[3].wait);
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(0, procs[i].burst_left);
+    }
+    free(procs);
+}
+void test_sched_find(void) {
+    int count = 0;
+    const struct sched_algo* algos = sched_algos(&count);
+    TEST_ASSERT_TRUE(count >= 5);
+    for (int i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL_PTR(&algos[i], sched_find(algos[i].name));
+        TEST_ASSERT_EQUAL(algos[i].parse != NULL, (algos[i].flags & SCHED_PARAM) != 0);
+    }
+    TEST_ASSERT_NULL(sched_find("lifo"));
+}
+void test_sched_parse_spec(void) {
+    struct sched_spec spec;
+    char label[32];
+
+    TEST_ASSERT_TRUE(sched_parse_spec("rr:4", &spec));
+    TEST_ASSERT_EQUAL_STRING("rr", spec.algo->name);
+    TEST_ASSERT_EQUAL_INT(4, spec.param);
+    sched_label(&spec, label, sizeof(label));
+    TEST_ASSERT_EQUAL_STRING("RR(4)", label);
+
+    TEST_ASSERT_TRUE(sched_parse_spec("fcfs", &spec));
+    sched_label(&spec, label, sizeof(label));
+    TEST_ASSERT_EQUAL_STRING("FCFS", label);
+
+    TEST_ASSERT_TRUE(sched_parse_spec("eevdf:3", &spec));
+    TEST_ASSERT_TRUE(spec.algo->flags & SCHED_PRIORITY);
+    sched_label(&spec, label, sizeof(label));
+    TEST_ASSERT_EQUAL_STRING("EEVDF(3)", label);
+
+    TEST_ASSERT_FALSE(sched_parse_spec("rr", &spec));
+    TEST_ASSERT_FALSE(sched_parse_spec("rr:0", &spec));
+    TEST_ASSERT_FALSE(sched_parse_spec("rr:x", &spec));
+    TEST_ASSERT_FALSE(sched_parse_spec("fcfs:1", &spec));
+    TEST_ASSERT_FALSE(sched_parse_spec("nope:1", &spec));
+}
+void test_sched_run_leaves_input(void) {
+    // Given
+    int bursts[] = { 5, 8, 2 };
+    struct pcb* procs = init_procs(bursts, 3);
+    struct pcb scratch[3];
+    struct sched_spec spec;
+    struct sched_result result;
+
+    // When
+    TEST_ASSERT_TRUE(sched_parse_spec("rr:2", &spec));
+    TEST_ASSERT_TRUE(sched_run(&spec, procs, 3, scratch, &result));
+
+    // Then: same as rr_run, input untouched
+    TEST_ASSERT_EQUAL_INT(15, result.total_time);
+    TEST_ASSERT_TRUE(result.avg_wait == 17.0 / 3);
+    TEST_ASSERT_EQUAL_INT(5, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+
+    TEST_ASSERT_TRUE(sched_parse_spec("sjf", &spec));
+    TEST_ASSERT_TRUE(sched_run(&spec, procs, 3, scratch, &result));
+    TEST_ASSERT_TRUE(result.avg_wait == 3.0);
+    free(procs);
+}
+
+void test_sched_compare_matches_sequential(void) {
+    // Given
+    int plen = 1000;
+    int* bursts = malloc(sizeof(int) * plen);
+    for (int i = 0; i < plen; i++) {
+        bursts[i] = 1 + (i * 37) % 23;
+    }
+    struct pcb* procs = init_procs(bursts, plen);
+    struct pcb* scratch = malloc(sizeof(struct pcb) * plen);
+    const char* texts[] = { "fcfs", "sjf", "rr:1", "rr:4", "rr:16", "prio-p:3" };
+    struct sched_spec specs[6];
+    struct sched_result results[6];
+    for (int i = 0; i < 6; i++) {
+        TEST_ASSERT_TRUE(sched_parse_spec(texts[i], &specs[i]));
+    }
+
+    // When
+    TEST_ASSERT_TRUE(sched_compare(specs, 6, procs, plen, 4, results));
+
+    // Then: each row matches a sequential run, input untouched
+    for (int i = 0; i < 6; i++) {
+        struct sched_result expect;
+        TEST_ASSERT_TRUE(sched_run(&specs[i], procs, plen, scratch, &expect));
+        TEST_ASSERT_EQUAL_INT(expect.total_time, results[i].total_time);
+        TEST_ASSERT_EQUAL_INT(expect.p99_wait, results[i].p99_wait);
+        TEST_ASSERT_TRUE(expect.avg_wait == results[i].avg_wait);
+    }
+    TEST_ASSERT_EQUAL_INT(bursts[7], procs[7].burst_left);
+    free(bursts);
+    free(procs);
+    free(scratch);
+}
+void test_sched_p99_wait(void) {
+    // Given: FCFS waits are 0, 1, ..., 199
+    int bursts[200];
+    for (int i = 0; i < 200; i++) {
+        bursts[i] = 1;
+    }
+    struct pcb* procs = init_procs(bursts, 200);
+    struct sched_spec spec;
+    struct sched_result result;
+
+    // When
+    TEST_ASSERT_TRUE(sched_parse_spec("fcfs", &spec));
+    TEST_ASSERT_TRUE(sched_run(&spec, procs, 200, procs, &result));
+
+    // Then: the 198th smallest
+    TEST_ASSERT_EQUAL_INT(197, result.p99_wait);
+    free(procs);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sjf_run);
+    RUN_TEST(test_sched_find);
+    RUN_TEST(test_sched_parse_spec);
+    RUN_TEST(test_sched_run_leaves_input);
+    RUN_TEST(test_sched_compare_matches_sequential);
+    RUN_TEST(test_sched_p99_wait);
+    return UNITY_END();
+}
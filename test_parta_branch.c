@@ -0,0 +1,112 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_branch.h"
+#include <stdlib.h> // For malloc/free
+
+static struct branch* root = NULL;
+static struct branch* child = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    root = NULL;
+    child = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    branch_free(child);
+    branch_free(root);
+}
+
+void test_branch_matches_rr(void) {
+    // When
+    root = branch_create((int[]){5, 8, 2}, 3, 2);
+    TEST_ASSERT_NOT_NULL(root);
+    int total_time = branch_run(root);
+    struct pcb out[3];
+    branch_export(root, out);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(15, total_time);
+    TEST_ASSERT_EQUAL_INT(0, out[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(6, out[0].wait);
+    TEST_ASSERT_EQUAL_INT(7, out[1].wait);
+    TEST_ASSERT_EQUAL_INT(4, out[2].wait);
+}
+void test_branch_midrun_export(void) {
+    // When: RR(4) over 5, 8 stopped after the first slice
+    root = branch_create((int[]){5, 8}, 2, 4);
+    TEST_ASSERT_NOT_NULL(root);
+    int now = branch_run_until(root, 1);
+    struct pcb out[2];
+    branch_export(root, out);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(4, now);
+    TEST_ASSERT_EQUAL_INT(1, out[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(0, out[0].wait);
+    TEST_ASSERT_EQUAL_INT(8, out[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(4, out[1].wait);
+}
+void test_branch_fork_diverges(void) {
+    // When: fork at t=2, child switches to RR(4)
+    root = branch_create((int[]){5, 8, 2}, 3, 2);
+    TEST_ASSERT_NOT_NULL(root);
+    branch_run_until(root, 2);
+    child = branch_fork(root);
+    TEST_ASSERT_NOT_NULL(child);
+    branch_set_quantum(child, 4);
+
+    int root_time = branch_run(root);
+    int child_time = branch_run(child);
+    struct pcb r[3];
+    struct pcb c[3];
+    branch_export(root, r);
+    branch_export(child, c);
+
+    // Then: the parent is unaffected by its child
+    TEST_ASSERT_EQUAL_INT(15, root_time);
+    TEST_ASSERT_EQUAL_INT(6, r[0].wait);
+    TEST_ASSERT_EQUAL_INT(7, r[1].wait);
+    TEST_ASSERT_EQUAL_INT(4, r[2].wait);
+    // Child: P0 2 | P1 4 | P2 2 | P0 3 | P1 4
+    TEST_ASSERT_EQUAL_INT(15, child_time);
+    TEST_ASSERT_EQUAL_INT(6, c[0].wait);
+    TEST_ASSERT_EQUAL_INT(7, c[1].wait);
+    TEST_ASSERT_EQUAL_INT(6, c[2].wait);
+}
+void test_branch_fork_shares_chunks(void) {
+    // Set up 4 chunks of single-slice processes
+    int plen = 4 * BRANCH_CHUNK;
+    int* bursts = malloc(sizeof(int) * plen);
+    TEST_ASSERT_NOT_NULL(bursts);
+    for (int i = 0; i < plen; i++) {
+        bursts[i] = 1;
+    }
+    root = branch_create(bursts, plen, 1);
+    free(bursts);
+    TEST_ASSERT_NOT_NULL(root);
+
+    // When
+    child = branch_fork(root);
+    TEST_ASSERT_NOT_NULL(child);
+
+    // Then: nothing copied until a branch writes
+    TEST_ASSERT_EQUAL_INT(0, branch_private_chunks(root));
+    TEST_ASSERT_EQUAL_INT(0, branch_private_chunks(child));
+
+    // Running the child through the first chunk copies only that chunk
+    branch_run_until(child, BRANCH_CHUNK);
+    TEST_ASSERT_EQUAL_INT(1, branch_private_chunks(child));
+    TEST_ASSERT_EQUAL_INT(1, branch_private_chunks(root));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_branch_matches_rr);
+    RUN_TEST(test_branch_midrun_export);
+    RUN_TEST(test_branch_fork_diverges);
+    RUN_TEST(test_branch_fork_shares_chunks);
+
+    return UNITY_END();
+}
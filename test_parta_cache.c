@@ -0,0 +1,244 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_cache.h"
+#include <dirent.h>
+#include <stdlib.h> // For malloc/free
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+static struct result_cache* cache = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    cache = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    cache_free(cache);
+}
+
+static struct sched_spec spec_of(const char* text) {
+    struct sched_spec spec;
+    TEST_ASSERT_TRUE(sched_parse_spec(text, &spec));
+    return spec;
+}
+
+void test_hash64_reference_values(void) {
+    // XXH64 reference values
+    TEST_ASSERT_TRUE(parta_hash64("", 0, 0) == 0xEF46DB3751D8E999ULL);
+    TEST_ASSERT_TRUE(parta_hash64("abc", 3, 0) == 0x44BC2CF5AD770999ULL);
+    const char* long_text = "Nobody inspects the spammish repetition";
+    TEST_ASSERT_TRUE(parta_hash64(long_text, strlen(long_text), 0) == 0xFBCEA83C8A378BF1ULL);
+}
+
+void test_cache_hit_matches_run(void) {
+    // Given
+    cache = cache_create(1 << 20, NULL);
+    int bursts[] = { 5, 8, 2, 0 };
+    struct pcb* a = init_procs(bursts, 4);
+    struct pcb* b = init_procs(bursts, 4);
+    struct pcb* c = init_procs(bursts, 4);
+    struct sched_spec rr = spec_of("rr:2");
+
+    // When: the second identical query is a hit
+    int t1 = cache_run(cache, &rr, a, 4);
+    int t2 = cache_run(cache, &rr, b, 4);
+    rr_run(c, 4, 2);
+
+    // Then
+    struct cache_stats stats;
+    cache_stats(cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.misses);
+    TEST_ASSERT_EQUAL_INT(1, stats.hits);
+    TEST_ASSERT_EQUAL_INT(1, stats.entries);
+    TEST_ASSERT_EQUAL_INT(15, t1);
+    TEST_ASSERT_EQUAL_INT(t1, t2);
+    TEST_ASSERT_EQUAL_MEMORY(c, a, sizeof(struct pcb) * 4);
+    TEST_ASSERT_EQUAL_MEMORY(c, b, sizeof(struct pcb) * 4);
+    free(a);
+    free(b);
+    free(c);
+}
+
+void test_cache_key_includes_algorithm_and_param(void) {
+    // Given
+    cache = cache_create(1 << 20, NULL);
+    int bursts[] = { 5, 8, 2 };
+    const char* texts[] = { "rr:2", "rr:4", "fcfs", "sjf", "rr:2" };
+
+    // When
+    double avg[5];
+    for (int i = 0; i < 5; i++) {
+        struct pcb* procs = init_procs(bursts, 3);
+        struct sched_spec spec = spec_of(texts[i]);
+        struct sched_result result;
+        TEST_ASSERT_TRUE(cache_sched_run(cache, &spec, procs, 3, procs, &result));
+        avg[i] = result.avg_wait;
+        free(procs);
+    }
+
+    // Then: only the repeated rr:2 hits
+    struct cache_stats stats;
+    cache_stats(cache, &stats);
+    TEST_ASSERT_EQUAL_INT(4, stats.misses);
+    TEST_ASSERT_EQUAL_INT(1, stats.hits);
+    TEST_ASSERT_TRUE(avg[0] == 17.0 / 3);
+    TEST_ASSERT_TRUE(avg[1] == 7.0);
+    TEST_ASSERT_TRUE(avg[2] == 6.0);
+    TEST_ASSERT_TRUE(avg[3] == 3.0);
+    TEST_ASSERT_TRUE(avg[4] == avg[0]);
+}
+
+static void reset(struct pcb* procs, int prio0) {
+    procs[0] = (struct pcb){ 0, 5, 0, prio0 };
+    procs[1] = (struct pcb){ 1, 8, 0, 0 };
+}
+
+void test_cache_priority_only_keyed_when_used(void) {
+    // Given
+    cache = cache_create(1 << 20, NULL);
+    struct pcb procs[2];
+    struct sched_spec fcfs = spec_of("fcfs");
+    struct sched_spec prio = spec_of("prio:0");
+
+    // When: P0's priority changes between queries
+    reset(procs, 0);
+    cache_run(cache, &fcfs, procs, 2);
+    reset(procs, 3);
+    cache_run(cache, &fcfs, procs, 2);
+    reset(procs, 0);
+    cache_run(cache, &prio, procs, 2);
+    reset(procs, 3);
+    cache_run(cache, &prio, procs, 2);
+
+    // Then: FCFS ignores priorities, PRIO does not
+    struct cache_stats stats;
+    cache_stats(cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.hits);
+    TEST_ASSERT_EQUAL_INT(3, stats.misses);
+    TEST_ASSERT_EQUAL_INT(8, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+}
+
+void test_cache_lru_eviction(void) {
+    // Given: room for about two three-process entries
+    cache = cache_create(2 * (sizeof(int) * 5 + 128), NULL);
+    struct sched_spec fcfs = spec_of("fcfs");
+    struct pcb procs[3];
+
+    // When: A, B, touch A, C (evicts B), B again
+    int workloads[][3] = { { 1, 2, 3 }, { 4, 5, 6 }, { 1, 2, 3 }, { 7, 8, 9 }, { 4, 5, 6 },
+                           { 1, 2, 3 } };
+    for (int w = 0; w < 6; w++) {
+        for (int i = 0; i < 3; i++) {
+            procs[i] = (struct pcb){ i, workloads[w][i], 0, 0 };
+        }
+        cache_run(cache, &fcfs, procs, 3);
+    }
+
+    // Then
+    struct cache_stats stats;
+    cache_stats(cache, &stats);
+    TEST_ASSERT_TRUE(stats.bytes <= 2 * (sizeof(int) * 5 + 128));
+    TEST_ASSERT_EQUAL_INT(1, stats.hits);
+    TEST_ASSERT_EQUAL_INT(5, stats.misses);
+    TEST_ASSERT_TRUE(stats.evictions >= 2);
+}
+
+void test_cache_disk_store(void) {
+    // Given
+    char dir[] = "/tmp/parta_cache_XXXXXX";
+    TEST_ASSERT_NOT_NULL(mkdtemp(dir));
+    int bursts[] = { 5, 8, 2 };
+    struct sched_spec rr = spec_of("rr:3");
+    struct pcb* first = init_procs(bursts, 3);
+    struct pcb* second = init_procs(bursts, 3);
+
+    // When: a fresh cache over the same directory
+    cache = cache_create(1 << 20, dir);
+    int t1 = cache_run(cache, &rr, first, 3);
+    cache_free(cache);
+    cache = cache_create(1 << 20, dir);
+    int t2 = cache_run(cache, &rr, second, 3);
+
+    // Then
+    struct cache_stats stats;
+    cache_stats(cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.disk_hits);
+    TEST_ASSERT_EQUAL_INT(0, stats.misses);
+    TEST_ASSERT_EQUAL_INT(t1, t2);
+    TEST_ASSERT_EQUAL_MEMORY(first, second, sizeof(struct pcb) * 3);
+
+    char cmd[64];
+    snprintf(cmd, sizeof(cmd), "rm -rf %s", dir);
+    TEST_ASSERT_EQUAL_INT(0, system(cmd));
+    free(first);
+    free(second);
+}
+
+void test_cache_disk_garbage_is_miss(void) {
+    // Given: the stored entry overwritten with the magic, then a name
+    // field that starts like "rr" but has no NUL, then nothing
+    char dir[] = "/tmp/parta_cache_XXXXXX";
+    TEST_ASSERT_NOT_NULL(mkdtemp(dir));
+    int bursts[] = { 5, 8, 2 };
+    struct sched_spec rr = spec_of("rr:3");
+    struct pcb* first = init_procs(bursts, 3);
+    struct pcb* second = init_procs(bursts, 3);
+    cache = cache_create(1 << 20, dir);
+    int t1 = cache_run(cache, &rr, first, 3);
+    cache_free(cache);
+
+    DIR* d = opendir(dir);
+    TEST_ASSERT_NOT_NULL(d);
+    int corrupted = 0;
+    for (struct dirent* de = readdir(d); de != NULL; de = readdir(d)) {
+        if (strstr(de->d_name, ".prc") == NULL) {
+            continue;
+        }
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", dir, de->d_name);
+        FILE* f = fopen(path, "wb");
+        TEST_ASSERT_NOT_NULL(f);
+        uint32_t magic = 0x31435250u;
+        char name[16];
+        memset(name, 'x', sizeof(name));
+        memcpy(name, "rr", 2);
+        fwrite(&magic, sizeof(magic), 1, f);
+        fwrite(name, sizeof(name), 1, f);
+        fclose(f);
+        corrupted++;
+    }
+    closedir(d);
+    TEST_ASSERT_EQUAL_INT(1, corrupted);
+
+    // When
+    cache = cache_create(1 << 20, dir);
+    int t2 = cache_run(cache, &rr, second, 3);
+
+    // Then: a miss, recomputed
+    struct cache_stats stats;
+    cache_stats(cache, &stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.disk_hits);
+    TEST_ASSERT_EQUAL_INT(1, stats.misses);
+    TEST_ASSERT_EQUAL_INT(t1, t2);
+    TEST_ASSERT_EQUAL_MEMORY(first, second, sizeof(struct pcb) * 3);
+
+    char cmd[64];
+    snprintf(cmd, sizeof(cmd), "rm -rf %s", dir);
+    TEST_ASSERT_EQUAL_INT(0, system(cmd));
+    free(first);
+    free(second);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_hash64_reference_values);
+    RUN_TEST(test_cache_hit_matches_run);
+    RUN_TEST(test_cache_key_includes_algorithm_and_param);
+    RUN_TEST(test_cache_priority_only_keyed_when_used);
+    RUN_TEST(test_cache_lru_eviction);
+    RUN_TEST(test_cache_disk_store);
+    RUN_TEST(test_cache_disk_garbage_is_miss);
+    return UNITY_END();
+}
@@ -0,0 +1,91 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_cli.h"
+#include <stdio.h>  // For tmpfile
+#include <string.h>
+#include <unistd.h>
+
+void setUp(void) {
+    // Code to execute at test start up
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+}
+
+void test_parse_int_valid(void) {
+    int v = -1;
+    TEST_ASSERT_TRUE(parse_int("0", &v));
+    TEST_ASSERT_EQUAL_INT(0, v);
+    TEST_ASSERT_TRUE(parse_int("+42", &v));
+    TEST_ASSERT_EQUAL_INT(42, v);
+    TEST_ASSERT_TRUE(parse_int("-7", &v));
+    TEST_ASSERT_EQUAL_INT(-7, v);
+    TEST_ASSERT_TRUE(parse_int("2147483647", &v));
+    TEST_ASSERT_EQUAL_INT(2147483647, v);
+    TEST_ASSERT_TRUE(parse_int("-2147483648", &v));
+    TEST_ASSERT_EQUAL_INT(-2147483647 - 1, v);
+}
+void test_parse_int_rejects_garbage(void) {
+    int v = 99;
+    TEST_ASSERT_FALSE(parse_int("", &v));
+    TEST_ASSERT_FALSE(parse_int("abc", &v));
+    TEST_ASSERT_FALSE(parse_int("5x", &v));
+    TEST_ASSERT_FALSE(parse_int(" 5", &v));
+    TEST_ASSERT_FALSE(parse_int("-", &v));
+    TEST_ASSERT_FALSE(parse_int("2147483648", &v));
+    TEST_ASSERT_FALSE(parse_int("99999999999999999999", &v));
+    TEST_ASSERT_EQUAL_INT(99, v);
+}
+void test_parse_burst(void) {
+    int b = 0, p = -1;
+    TEST_ASSERT_TRUE(parse_burst("5", &b, &p));
+    TEST_ASSERT_EQUAL_INT(5, b);
+    TEST_ASSERT_EQUAL_INT(0, p);
+    TEST_ASSERT_TRUE(parse_burst("8:3", &b, &p));
+    TEST_ASSERT_EQUAL_INT(8, b);
+    TEST_ASSERT_EQUAL_INT(3, p);
+    TEST_ASSERT_FALSE(parse_burst("8:", &b, &p));
+    TEST_ASSERT_FALSE(parse_burst(":3", &b, &p));
+    TEST_ASSERT_FALSE(parse_burst("8:3", &b, NULL));
+}
+void test_out_buf_format(void) {
+    // Given: output goes to a temporary file
+    FILE* f = tmpfile();
+    TEST_ASSERT_NOT_NULL(f);
+    struct out_buf out;
+    out_init(&out, fileno(f), 4);
+
+    // When: enough is written to force the buffer to grow
+    out_str(&out, "Accepted P");
+    out_int(&out, 0);
+    out_str(&out, ": Burst ");
+    out_int(&out, -2147483647 - 1);
+    out_char(&out, ' ');
+    out_fixed2(&out, 6.666);
+    out_char(&out, ' ');
+    out_fixed2(&out, 5.0);
+    out_char(&out, ' ');
+    out_fixed2(&out, 0.125);
+    out_char(&out, ' ');
+    out_fixed2(&out, 1.0 / 8 + 1);
+    out_char(&out, ' ');
+    out_fixed2(&out, 0.625);
+    TEST_ASSERT_TRUE(out_flush(&out));
+    out_free(&out);
+
+    // Then
+    char buf[128] = { 0 };
+    rewind(f);
+    size_t n = fread(buf, 1, sizeof(buf) - 1, f);
+    fclose(f);
+    TEST_ASSERT_EQUAL_STRING("Accepted P0: Burst -2147483648 6.67 5.00 0.12 1.12 0.62", buf);
+    TEST_ASSERT_EQUAL_INT(strlen(buf), n);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_parse_int_valid);
+    RUN_TEST(test_parse_int_rejects_garbage);
+    RUN_TEST(test_parse_burst);
+    RUN_TEST(test_out_buf_format);
+    return UNITY_END();
+}
@@ -0,0 +1,207 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_coro.h"
+#include "parta_io.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+    procs = NULL;
+}
+
+/** A request handler: `requests` rounds of CPU then I/O */
+struct handler_state {
+    int requests;
+    int cpu;
+    int io;
+    int i;
+};
+
+static void handler(struct coro* co) {
+    struct handler_state* s = co->state;
+    CO_BEGIN(co);
+    for (s->i = 0; s->i < s->requests; s->i++) {
+        CO_YIELD(co, CORO_CPU, s->cpu);
+        CO_YIELD(co, CORO_IO, s->io);
+    }
+    CO_END(co);
+}
+
+/** Replays a CPU, sleep, CPU, ... phase list, like an io_workload */
+struct script_state {
+    const int* phases;
+    int count;
+    int k;
+};
+
+static void script(struct coro* co) {
+    struct script_state* s = co->state;
+    CO_BEGIN(co);
+    for (s->k = 0; s->k < s->count; s->k++) {
+        if (s->k % 2 == 0) {
+            CO_YIELD(co, CORO_CPU, s->phases[s->k]);
+        } else {
+            CO_YIELD(co, CORO_SLEEP, s->phases[s->k]);
+        }
+    }
+    CO_END(co);
+}
+
+/** Backs off: sleeps as long as it was kept waiting for the CPU */
+struct backoff_state {
+    int rounds;
+    int i;
+    int slept;
+};
+
+static void backoff(struct coro* co) {
+    struct backoff_state* s = co->state;
+    CO_BEGIN(co);
+    for (s->i = 0; s->i < s->rounds; s->i++) {
+        CO_YIELD(co, CORO_CPU, 4);
+        s->slept += co->delay;
+        CO_YIELD(co, CORO_SLEEP, co->delay);
+    }
+    CO_END(co);
+}
+
+void test_coro_handlers_share_device(void) {
+    // Given: two handlers of 2 requests (CPU 2, I/O 5) on one device
+    struct handler_state st[2] = { { 2, 2, 5, 0 }, { 2, 2, 5, 0 } };
+    struct coro cos[2];
+    for (int i = 0; i < 2; i++) {
+        coro_init(&cos[i], handler, &st[i]);
+    }
+    procs = malloc(sizeof(struct pcb) * 2);
+
+    // When
+    struct coro_stats stats;
+    int total = coro_run(cos, 2, 0, procs, &stats);
+
+    // Then: P0 CPU 0-2, I/O 2-7; P1 CPU 2-4, I/O 7-12 (queued behind P0);
+    // P0 CPU 7-9, I/O 12-17; P1 CPU 12-14, I/O 17-22
+    TEST_ASSERT_EQUAL_INT(22, total);
+    TEST_ASSERT_EQUAL_INT(22, stats.total_time);
+    TEST_ASSERT_EQUAL_INT(8, stats.busy);
+    TEST_ASSERT_EQUAL_INT(20, stats.io_busy);
+    TEST_ASSERT_EQUAL_INT(2, stats.completed);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(2, procs[1].wait);
+    // 2 starts and 2 resumes per request each
+    TEST_ASSERT_TRUE(stats.resumes == 2 * (1 + 2 * 2));
+    TEST_ASSERT_EQUAL_INT(-1, cos[0].line);
+    TEST_ASSERT_EQUAL_INT(CORO_EXIT, cos[1].op);
+}
+
+void test_coro_matches_io_run(void) {
+    // Given: random CPU/sleep scripts, also as an io_workload
+    enum { N = 300, MAX_PHASES = 7 };
+    int phases[N * MAX_PHASES];
+    int counts[N];
+    struct script_state st[N];
+    struct coro cos[N];
+    srand(50);
+    int total_phases = 0;
+    for (int i = 0; i < N; i++) {
+        counts[i] = rand() % (MAX_PHASES + 1);
+        for (int k = 0; k < counts[i]; k++) {
+            phases[total_phases + k] = (rand() % 6 == 0) ? 0 : 1 + rand() % 30;
+        }
+        st[i] = (struct script_state){ &phases[total_phases], counts[i], 0 };
+        total_phases += counts[i];
+    }
+    struct io_workload* w = io_init(phases, counts, N);
+    struct pcb* expected = malloc(sizeof(struct pcb) * N);
+    procs = malloc(sizeof(struct pcb) * N);
+
+    for (int quantum = 0; quantum <= 3; quantum += 3) {
+        for (int i = 0; i < N; i++) {
+            st[i].k = 0;
+            coro_init(&cos[i], script, &st[i]);
+        }
+
+        // When
+        int expected_total = (quantum == 0) ? io_fcfs_run(w, expected, NULL)
+                                            : io_rr_run(w, quantum, expected, NULL);
+        int total = coro_run(cos, N, quantum, procs, NULL);
+
+        // Then: sleeps overlap like io_run's I/O, so the schedules agree
+        TEST_ASSERT_EQUAL_INT(expected_total, total);
+        for (int i = 0; i < N; i++) {
+            TEST_ASSERT_EQUAL_INT(expected[i].wait, procs[i].wait);
+        }
+    }
+    io_free(w);
+    free(expected);
+}
+
+void test_coro_sees_its_delay(void) {
+    // Given: two processes that sleep off the time they spent waiting
+    struct backoff_state st[2] = { { 2, 0, 0 }, { 2, 0, 0 } };
+    struct coro cos[2];
+    for (int i = 0; i < 2; i++) {
+        coro_init(&cos[i], backoff, &st[i]);
+    }
+    procs = malloc(sizeof(struct pcb) * 2);
+
+    // When
+    int total = coro_run(cos, 2, 2, procs, NULL);
+
+    // Then: with quantum 2, P0 runs 0-2, 4-6 (delay 2) and P1 runs 2-4,
+    // 6-8 (delay 4); P0 sleeps 6-8 and P1 8-12, so the second round has
+    // no contention
+    TEST_ASSERT_EQUAL_INT(2, st[0].slept);
+    TEST_ASSERT_EQUAL_INT(4, st[1].slept);
+    TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(4, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(16, total);
+}
+
+void test_coro_zero_requests(void) {
+    // Given: handlers whose requests take no time
+    struct handler_state st[3] = { { 3, 0, 0, 0 }, { 0, 5, 5, 0 }, { 1, 3, 0, 0 } };
+    struct coro cos[3];
+    for (int i = 0; i < 3; i++) {
+        coro_init(&cos[i], handler, &st[i]);
+    }
+    procs = malloc(sizeof(struct pcb) * 3);
+
+    // When
+    struct coro_stats stats;
+    int total = coro_run(cos, 3, 1, procs, &stats);
+
+    // Then: only P2's CPU request takes time
+    TEST_ASSERT_EQUAL_INT(3, total);
+    TEST_ASSERT_EQUAL_INT(3, stats.completed);
+    TEST_ASSERT_EQUAL_INT(0, stats.io_busy);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].wait);
+}
+
+void test_coro_rejects_bad_input(void) {
+    struct handler_state st = { 1, 1, 1, 0 };
+    struct coro cos[2];
+    coro_init(&cos[0], handler, &st);
+    coro_init(&cos[1], NULL, NULL);
+    procs = malloc(sizeof(struct pcb) * 2);
+
+    TEST_ASSERT_EQUAL_INT(0, coro_run(cos, 2, 1, procs, NULL));
+    TEST_ASSERT_EQUAL_INT(0, coro_run(cos, 1, -1, procs, NULL));
+    TEST_ASSERT_EQUAL_INT(0, coro_run(cos, 0, 1, procs, NULL));
+    TEST_ASSERT_EQUAL_INT(0, coro_run(cos, 1, 1, NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(0, cos[0].line);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_coro_handlers_share_device);
+    RUN_TEST(test_coro_matches_io_run);
+    RUN_TEST(test_coro_sees_its_delay);
+    RUN_TEST(test_coro_zero_requests);
+    RUN_TEST(test_coro_rejects_bad_input);
+    return UNITY_END();
+}
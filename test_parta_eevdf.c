@@ -0,0 +1,176 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_eevdf.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+    procs = NULL;
+}
+
+/**
+ * The same rules as eevdf_run with a linear scan per pick, for
+ * comparison.
+ */
+static int eevdf_reference(struct pcb* p, int plen, const int* weights, int slice,
+                           int* latency) {
+    long long* v = calloc(plen, sizeof(long long));
+    long long* deadline = malloc(sizeof(long long) * plen);
+    int* burst = malloc(sizeof(int) * plen);
+    long long load = 0;
+    __int128 sum = 0;
+    for (int i = 0; i < plen; i++) {
+        burst[i] = p[i].burst_left;
+        deadline[i] = (long long)(EEVDF_SCALE / weights[i]) * slice;
+        latency[i] = 0;
+        load += (burst[i] > 0) ? weights[i] : 0;
+    }
+
+    int total_time = 0;
+    for (;;) {
+        int best = -1;
+        for (int i = 0; i < plen; i++) {
+            if (p[i].burst_left > 0 && (__int128)v[i] * load <= sum &&
+                (best < 0 || deadline[i] < deadline[best])) {
+                best = i;
+            }
+        }
+        if (best < 0) {
+            break;
+        }
+        if (p[best].burst_left == burst[best]) {
+            latency[best] = total_time;
+        }
+        int run_time = (p[best].burst_left < slice) ? p[best].burst_left : slice;
+        long long stride = EEVDF_SCALE / weights[best];
+        total_time += run_time;
+        p[best].burst_left -= run_time;
+        v[best] += stride * run_time;
+        sum += (__int128)weights[best] * stride * run_time;
+        deadline[best] = v[best] + stride * slice;
+        if (p[best].burst_left == 0) {
+            p[best].wait += total_time - burst[best];
+            load -= weights[best];
+            sum -= (__int128)weights[best] * v[best];
+        }
+    }
+    free(v);
+    free(deadline);
+    free(burst);
+    return total_time;
+}
+
+void test_eevdf_equal_weights_is_rr(void) {
+    // Given: default priorities, so every weight is the same
+    int bursts[] = { 7, 0, 3, 12, 5, 9, 1, 4 };
+    struct pcb* rr = init_procs(bursts, 8);
+    procs = init_procs(bursts, 8);
+    int latency[8];
+
+    // When
+    int total = eevdf_run(procs, 8, NULL, 3, latency);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(rr_run(rr, 8, 3), total);
+    for (int i = 0; i < 8; i++) {
+        TEST_ASSERT_EQUAL_INT(rr[i].wait, procs[i].wait);
+        TEST_ASSERT_EQUAL_INT(0, procs[i].burst_left);
+    }
+    int expected_latency[] = { 0, 0, 3, 6, 9, 12, 15, 16 };
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected_latency, latency, 8);
+    free(rr);
+}
+
+void test_eevdf_weights_split_service(void) {
+    // Given: weights 3 and 1, equal work, slice 1
+    int bursts[] = { 12, 12 };
+    int weights[] = { 3, 1 };
+    procs = init_procs(bursts, 2);
+    int latency[2];
+
+    // When
+    int total = eevdf_run(procs, 2, weights, 1, latency);
+
+    // Then: P0 gets 3 ticks of every 4, so it is done by 16
+    TEST_ASSERT_EQUAL_INT(24, total);
+    TEST_ASSERT_EQUAL_INT(4, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(12, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, latency[0]);
+    TEST_ASSERT_TRUE(latency[1] > 0 && latency[1] <= 2);
+}
+
+void test_eevdf_matches_reference(void) {
+    // Given: random bursts and weights, including zero bursts
+    enum { N = 300 };
+    int bursts[N], weights[N];
+    int latency[N], expected_latency[N];
+    srand(48);
+    for (int i = 0; i < N; i++) {
+        bursts[i] = (i % 37 == 0) ? 0 : 1 + rand() % 40;
+        weights[i] = 1 + rand() % 100;
+    }
+
+    for (int slice = 1; slice <= 8; slice *= 2) {
+        // When
+        struct pcb* expected = init_procs(bursts, N);
+        procs = init_procs(bursts, N);
+        int expected_total = eevdf_reference(expected, N, weights, slice, expected_latency);
+        int total = eevdf_run(procs, N, weights, slice, latency);
+
+        // Then
+        TEST_ASSERT_EQUAL_INT(expected_total, total);
+        for (int i = 0; i < N; i++) {
+            TEST_ASSERT_EQUAL_INT(expected[i].wait, procs[i].wait);
+            TEST_ASSERT_EQUAL_INT(expected_latency[i], latency[i]);
+        }
+        free(expected);
+        free(procs);
+        procs = NULL;
+    }
+}
+
+void test_eevdf_priority_weights(void) {
+    // Given: weights from priorities, 0 the heaviest
+    TEST_ASSERT_EQUAL_INT(PRIO_LEVELS, eevdf_prio_weight(0));
+    TEST_ASSERT_EQUAL_INT(1, eevdf_prio_weight(PRIO_LEVELS - 1));
+    TEST_ASSERT_EQUAL_INT(1, eevdf_prio_weight(PRIO_LEVELS + 5));
+    int bursts[] = { 10, 10 };
+    procs = init_procs(bursts, 2);
+    procs[0].priority = PRIO_LEVELS - 1;
+
+    // When
+    int total = eevdf_run(procs, 2, NULL, 2, NULL);
+
+    // Then: P1 outweighs P0 64:1 and runs first; P0 only gets one slice
+    // in before P1 is done
+    TEST_ASSERT_EQUAL_INT(20, total);
+    TEST_ASSERT_EQUAL_INT(10, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(2, procs[1].wait);
+}
+
+void test_eevdf_rejects_bad_input(void) {
+    int bursts[] = { 3, 4 };
+    int weights[] = { 1, 0 };
+    procs = init_procs(bursts, 2);
+
+    TEST_ASSERT_EQUAL_INT(0, eevdf_run(procs, 2, weights, 1, NULL));
+    TEST_ASSERT_EQUAL_INT(0, eevdf_run(procs, 2, NULL, 0, NULL));
+    TEST_ASSERT_EQUAL_INT(0, eevdf_run(procs, 0, NULL, 1, NULL));
+    TEST_ASSERT_EQUAL_INT(3, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(7, eevdf_run(procs, 2, NULL, 1, NULL));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_eevdf_equal_weights_is_rr);
+    RUN_TEST(test_eevdf_weights_split_service);
+    RUN_TEST(test_eevdf_matches_reference);
+    RUN_TEST(test_eevdf_priority_weights);
+    RUN_TEST(test_eevdf_rejects_bad_input);
+    return UNITY_END();
+}
@@ -0,0 +1,154 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_group.h"
+#include "parta_share.h"
+#include <stdlib.h> // For malloc/free
+
+static struct group_tree* tree = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    tree = group_create();
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    group_free(tree);
+}
+
+static struct pcb* procs_for(const int* bursts, int plen) {
+    struct pcb* procs = init_procs((int*)bursts, plen);
+    TEST_ASSERT_NOT_NULL(procs);
+    return procs;
+}
+
+void test_group_paths(void) {
+    // Given: a nested group whose parent does not exist yet
+    int api = group_add(tree, "web/api", 3);
+
+    // Then: the parent is created with weight 1, ahead of its child
+    int web = group_find(tree, "web");
+    TEST_ASSERT_EQUAL_INT(1, web);
+    TEST_ASSERT_EQUAL_INT(2, api);
+    TEST_ASSERT_EQUAL_INT(1, group_weight(tree, web));
+    TEST_ASSERT_EQUAL_INT(3, group_weight(tree, api));
+    TEST_ASSERT_EQUAL_STRING("web/api", group_path(tree, api));
+    TEST_ASSERT_EQUAL_INT(0, group_find(tree, ""));
+
+    // When: the parent is given a weight afterwards
+    TEST_ASSERT_EQUAL_INT(web, group_add(tree, "web", 5));
+    TEST_ASSERT_EQUAL_INT(5, group_weight(tree, web));
+
+    // Then: bad paths and weights create nothing
+    TEST_ASSERT_EQUAL_INT(-1, group_add(tree, "db//x", 1));
+    TEST_ASSERT_EQUAL_INT(-1, group_add(tree, "/db", 1));
+    TEST_ASSERT_EQUAL_INT(-1, group_add(tree, "db/", 1));
+    TEST_ASSERT_EQUAL_INT(-1, group_add(tree, "db", 0));
+    TEST_ASSERT_EQUAL_INT(-1, group_add(tree, "db", STRIDE1 + 1));
+    TEST_ASSERT_EQUAL_INT(-1, group_add(tree, "a/b/c/d/e/f/g/h/i/j/k/l/m/n/o/p/q", 1));
+    TEST_ASSERT_EQUAL_INT(-1, group_find(tree, "db"));
+    TEST_ASSERT_EQUAL_INT(-1, group_find(tree, "a"));
+    TEST_ASSERT_EQUAL_INT(3, group_count(tree));
+}
+
+void test_group_flat_matches_stride(void) {
+    // Given: everything in the root, so one runqueue of weight-1 processes
+    int bursts[] = { 7, 0, 3, 12, 5, 9, 1 };
+    struct pcb* expected = procs_for(bursts, 7);
+    struct pcb* procs = procs_for(bursts, 7);
+    struct group_stats stats;
+
+    // When
+    int total = group_run(tree, procs, 7, NULL, 2, &stats);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(stride_run(expected, 7, NULL, 2, NULL), total);
+    long long sum = 0;
+    for (int i = 0; i < 7; i++) {
+        TEST_ASSERT_EQUAL_INT(expected[i].wait, procs[i].wait);
+        TEST_ASSERT_EQUAL_INT(0, procs[i].burst_left);
+        sum += procs[i].wait;
+    }
+    TEST_ASSERT_EQUAL_INT(37, stats.cpu);
+    TEST_ASSERT_EQUAL_INT(37, stats.finish);
+    TEST_ASSERT_EQUAL_INT(sum, stats.wait);
+    TEST_ASSERT_EQUAL_INT(7, stats.procs);
+    TEST_ASSERT_TRUE(stats.share == 1.0);
+    free(expected);
+    free(procs);
+}
+
+void test_group_weights_split_share(void) {
+    // Given: group a (weight 3) and b (weight 1), two 30-tick processes each
+    int a = group_add(tree, "a", 3);
+    int b = group_add(tree, "b", 1);
+    int bursts[] = { 30, 30, 30, 30 };
+    int groups[] = { a, b, a, b };
+    struct pcb* procs = procs_for(bursts, 4);
+    struct group_stats stats[3];
+
+    // When
+    int total = group_run(tree, procs, 4, groups, 1, stats);
+
+    // Then: a gets 3 ticks in 4 until it is done at 80, then b runs alone
+    TEST_ASSERT_EQUAL_INT(120, total);
+    TEST_ASSERT_EQUAL_INT(80, stats[a].finish);
+    TEST_ASSERT_EQUAL_INT(120, stats[b].finish);
+    TEST_ASSERT_TRUE(stats[a].share == 0.75);
+    TEST_ASSERT_TRUE(stats[b].share == 0.5);
+    TEST_ASSERT_EQUAL_INT(60, stats[a].cpu);
+    TEST_ASSERT_EQUAL_INT(2, stats[b].procs);
+    TEST_ASSERT_EQUAL_INT(120, stats[0].cpu);
+    TEST_ASSERT_EQUAL_INT(stats[a].wait + stats[b].wait, stats[0].wait);
+    TEST_ASSERT_EQUAL_INT(procs[0].wait + procs[2].wait, stats[a].wait);
+    TEST_ASSERT_TRUE(procs[0].wait >= 49 && procs[0].wait <= 50);
+    free(procs);
+}
+
+void test_group_nesting_is_per_level(void) {
+    // Given: a holds many processes, b only one; within a, y weighs 3x x
+    int x = group_add(tree, "a/x", 1);
+    int y = group_add(tree, "a/y", 3);
+    int b = group_add(tree, "b", 1);
+    int a = group_find(tree, "a");
+    int bursts[] = { 100, 100, 100, 100, 100, 100, 200 };
+    int groups[] = { x, x, y, y, y, y, b };
+    struct pcb* procs = procs_for(bursts, 7);
+    struct group_stats stats[5];
+
+    // When
+    int total = group_run(tree, procs, 7, groups, 1, stats);
+
+    // Then: b gets half the CPU regardless of how many processes a holds
+    TEST_ASSERT_EQUAL_INT(800, total);
+    TEST_ASSERT_EQUAL_INT(400, stats[b].finish);
+    TEST_ASSERT_TRUE(stats[b].share == 0.5);
+    TEST_ASSERT_EQUAL_INT(800, stats[a].finish);
+    TEST_ASSERT_EQUAL_INT(6, stats[a].procs);
+    // y has twice x's work at three times the weight, so it finishes first
+    TEST_ASSERT_TRUE(stats[y].finish < stats[x].finish);
+    TEST_ASSERT_EQUAL_INT(800, stats[x].finish);
+    TEST_ASSERT_EQUAL_INT(stats[x].wait + stats[y].wait, stats[a].wait);
+    free(procs);
+}
+
+void test_group_rejects_bad_input(void) {
+    int bursts[] = { 3, 4 };
+    int groups[] = { 0, 1 };
+    struct pcb* procs = procs_for(bursts, 2);
+
+    TEST_ASSERT_EQUAL_INT(0, group_run(tree, procs, 2, groups, 1, NULL));
+    TEST_ASSERT_EQUAL_INT(0, group_run(tree, procs, 2, NULL, 0, NULL));
+    TEST_ASSERT_EQUAL_INT(0, group_run(NULL, procs, 2, NULL, 1, NULL));
+    TEST_ASSERT_EQUAL_INT(3, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(7, group_run(tree, procs, 2, NULL, 1, NULL));
+    free(procs);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_group_paths);
+    RUN_TEST(test_group_flat_matches_stride);
+    RUN_TEST(test_group_weights_split_share);
+    RUN_TEST(test_group_nesting_is_per_level);
+    RUN_TEST(test_group_rejects_bad_input);
+    return UNITY_END();
+}
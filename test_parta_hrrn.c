@@ -0,0 +1,141 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_hrrn.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+    procs = NULL;
+}
+
+/** HRRN by rescanning every process at each decision, for comparison. */
+static int hrrn_reference(struct pcb* p, int plen, const int* arrival) {
+    long long t = 0;
+    for (;;) {
+        int best = -1;
+        long long first = -1;
+        for (int i = 0; i < plen; i++) {
+            if (p[i].burst_left <= 0) {
+                continue;
+            }
+            if (arrival[i] > t) {
+                first = (first < 0 || arrival[i] < first) ? arrival[i] : first;
+                continue;
+            }
+            // (t - a_i + b_i) / b_i > (t - a_best + b_best) / b_best
+            if (best < 0 || (__int128)(t - arrival[i] + p[i].burst_left) * p[best].burst_left >
+                                (__int128)(t - arrival[best] + p[best].burst_left) *
+                                    p[i].burst_left) {
+                best = i;
+            }
+        }
+        if (best < 0 && first < 0) {
+            return (int)t;
+        }
+        if (best < 0) {
+            t = first;
+            continue;
+        }
+        p[best].wait += (int)(t - arrival[best]);
+        t += p[best].burst_left;
+        p[best].burst_left = 0;
+    }
+}
+
+void test_hrrn_ratio_overtakes_short_job(void) {
+    // Given: P0 runs 0..10; by then P1 (burst 20, waited 10, ratio 1.5)
+    // outranks P2 (burst 2, waited 1, ratio 1.5, higher pid) and P3
+    // (burst 4, waited 0, ratio 1)
+    int bursts[] = { 10, 20, 2, 4 };
+    int arrival[] = { 0, 0, 9, 10 };
+    procs = init_procs(bursts, 4);
+
+    // When
+    int total = hrrn_run(procs, 4, arrival, NULL);
+
+    // Then: P1 on the tie, then P2 (waited 21 of 2) before P3
+    TEST_ASSERT_EQUAL_INT(36, total);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(10, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(21, procs[2].wait);
+    TEST_ASSERT_EQUAL_INT(22, procs[3].wait);
+}
+
+void test_hrrn_without_arrivals(void) {
+    // Given: everything arrives at 0
+    int bursts[] = { 7, 0, 3, 12, 5, 3, 1 };
+    procs = init_procs(bursts, 7);
+
+    // When
+    int total = hrrn_run(procs, 7, NULL, NULL);
+
+    // Then: every ratio is 1 at time 0, so P0 goes first; after that the
+    // same wait favors the shortest burst, as in SJF
+    TEST_ASSERT_EQUAL_INT(31, total);
+    int expected[] = { 0, 0, 8, 19, 14, 11, 7 };
+    for (int i = 0; i < 7; i++) {
+        TEST_ASSERT_EQUAL_INT(expected[i], procs[i].wait);
+        TEST_ASSERT_EQUAL_INT(0, procs[i].burst_left);
+    }
+}
+
+void test_hrrn_idles_until_arrival(void) {
+    int bursts[] = { 3, 4 };
+    int arrival[] = { 10, 2 };
+    procs = init_procs(bursts, 2);
+
+    TEST_ASSERT_EQUAL_INT(13, hrrn_run(procs, 2, arrival, NULL));
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+}
+
+void test_hrrn_matches_reference(void) {
+    // Given: random bursts and arrivals over a busy CPU
+    enum { N = 2000 };
+    int bursts[N], arrival[N];
+    srand(49);
+    for (int i = 0; i < N; i++) {
+        bursts[i] = (i % 101 == 0) ? 0 : 1 + rand() % ((i % 10 == 0) ? 300 : 20);
+        arrival[i] = rand() % (N * 12);
+    }
+    struct pcb* expected = init_procs(bursts, N);
+    procs = init_procs(bursts, N);
+
+    // When
+    long long events = -1;
+    int expected_total = hrrn_reference(expected, N, arrival);
+    int total = hrrn_run(procs, N, arrival, &events);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(expected_total, total);
+    for (int i = 0; i < N; i++) {
+        TEST_ASSERT_EQUAL_INT(expected[i].wait, procs[i].wait);
+    }
+    TEST_ASSERT_TRUE(events > 0 && events < (long long)N * 20);
+    free(expected);
+}
+
+void test_hrrn_rejects_bad_input(void) {
+    int bursts[] = { 3, 4 };
+    int arrival[] = { 0, -1 };
+    procs = init_procs(bursts, 2);
+
+    TEST_ASSERT_EQUAL_INT(0, hrrn_run(procs, 2, arrival, NULL));
+    TEST_ASSERT_EQUAL_INT(0, hrrn_run(procs, 0, NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(3, procs[0].burst_left);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_hrrn_ratio_overtakes_short_job);
+    RUN_TEST(test_hrrn_without_arrivals);
+    RUN_TEST(test_hrrn_idles_until_arrival);
+    RUN_TEST(test_hrrn_matches_reference);
+    RUN_TEST(test_hrrn_rejects_bad_input);
+    return UNITY_END();
+}
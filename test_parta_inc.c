@@ -0,0 +1,169 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_inc.h"
+#include <stdlib.h> // For malloc/free
+#include <string.h>
+
+static struct rr_inc* engine = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    engine = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    rr_inc_free(engine);
+}
+
+static unsigned int seed = 12345;
+
+static int next_burst(int max) {
+    seed = seed * 1103515245u + 12345u;
+    int r = (int)((seed >> 8) % (unsigned int)(max + 2));
+    return r - 1; // -1 .. max, so some processes are absent
+}
+
+/** Check the engine against a fresh rr_run over its current bursts. */
+static void assert_matches_rr(const int* bursts, int plen, int quantum) {
+    struct pcb* expected = init_procs((int*)bursts, plen);
+    struct pcb* actual = calloc(plen, sizeof(struct pcb));
+    int total = rr_run(expected, plen, quantum);
+    rr_inc_export(engine, actual);
+    TEST_ASSERT_EQUAL_INT(plen, rr_inc_len(engine));
+    TEST_ASSERT_EQUAL_INT(total, rr_inc_total(engine));
+    TEST_ASSERT_EQUAL_MEMORY(expected, actual, sizeof(struct pcb) * plen);
+    free(expected);
+    free(actual);
+}
+
+void test_analytic_run_example(void) {
+    // Given
+    int bursts[] = { 5, 8, 2 };
+    struct pcb* procs = init_procs(bursts, 3);
+
+    // When
+    int total = rr_analytic_run(procs, 3, 4);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(15, total);
+    TEST_ASSERT_EQUAL_INT(6, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(7, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(8, procs[2].wait);
+    free(procs);
+}
+
+void test_analytic_run_matches_rr(void) {
+    int quanta[] = { 1, 2, 3, 7, 50 };
+    for (int t = 0; t < 40; t++) {
+        // Given
+        int plen = 1 + t * 3;
+        int* bursts = malloc(sizeof(int) * plen);
+        for (int i = 0; i < plen; i++) {
+            bursts[i] = next_burst(30);
+        }
+        int quantum = quanta[t % 5];
+        struct pcb* expected = init_procs(bursts, plen);
+        struct pcb* actual = init_procs(bursts, plen);
+
+        // When
+        int t1 = rr_run(expected, plen, quantum);
+        int t2 = rr_analytic_run(actual, plen, quantum);
+
+        // Then
+        TEST_ASSERT_EQUAL_INT(t1, t2);
+        TEST_ASSERT_EQUAL_MEMORY(expected, actual, sizeof(struct pcb) * plen);
+        free(bursts);
+        free(expected);
+        free(actual);
+    }
+}
+
+void test_inc_set_example(void) {
+    // Given
+    int bursts[] = { 5, 8, 2 };
+    engine = rr_inc_create(bursts, 3, 4);
+
+    // When: P1 shrinks from 8 to 3
+    int k = rr_inc_set(engine, 1, 3);
+
+    // Then: 5,3,2 waits 3+2, 4, 4+3
+    const int* pids;
+    TEST_ASSERT_EQUAL_INT(k, rr_inc_changed(engine, &pids));
+    TEST_ASSERT_EQUAL_INT(10, rr_inc_total(engine));
+    TEST_ASSERT_EQUAL_INT(5, rr_inc_wait(engine, 0));
+    TEST_ASSERT_EQUAL_INT(4, rr_inc_wait(engine, 1));
+    TEST_ASSERT_EQUAL_INT(7, rr_inc_wait(engine, 2));
+    TEST_ASSERT_TRUE(rr_inc_avg_wait(engine) == 16.0 / 3);
+}
+
+void test_inc_random_updates_match_rr(void) {
+    int quanta[] = { 1, 3, 4, 10 };
+    for (int t = 0; t < 8; t++) {
+        // Given
+        int quantum = quanta[t % 4];
+        int plen = 20 + t;
+        int cap = plen + 200;
+        int* bursts = malloc(sizeof(int) * cap);
+        for (int i = 0; i < plen; i++) {
+            bursts[i] = next_burst(25);
+        }
+        engine = rr_inc_create(bursts, plen, quantum);
+        assert_matches_rr(bursts, plen, quantum);
+
+        // When: a mix of modifies, deletes and inserts
+        for (int step = 0; step < 200; step++) {
+            int op = step % 5;
+            if (op == 4 && plen < cap) {
+                bursts[plen] = next_burst(25);
+                TEST_ASSERT_EQUAL_INT(plen, rr_inc_insert(engine, bursts[plen]));
+                plen++;
+            } else if (op == 3) {
+                int pid = (step * 7) % plen;
+                bursts[pid] = 0;
+                TEST_ASSERT_TRUE(rr_inc_delete(engine, pid) >= 0);
+            } else {
+                int pid = (step * 13) % plen;
+                bursts[pid] = next_burst(25);
+                TEST_ASSERT_TRUE(rr_inc_set(engine, pid, bursts[pid]) >= 0);
+            }
+
+            // Then
+            assert_matches_rr(bursts, plen, quantum);
+        }
+        rr_inc_free(engine);
+        engine = NULL;
+        free(bursts);
+    }
+}
+
+void test_inc_update_touches_few(void) {
+    // Given: many short processes and one long one
+    int plen = 1000;
+    int* bursts = malloc(sizeof(int) * plen);
+    for (int i = 0; i < plen; i++) {
+        bursts[i] = 1 + i % 4;
+    }
+    bursts[500] = 100;
+    engine = rr_inc_create(bursts, plen, 4);
+
+    // When: the long process grows, then shrinks but still needs 2+ rounds
+    int grow = rr_inc_set(engine, 500, 120);
+    int shrink = rr_inc_set(engine, 500, 9);
+
+    // Then: only P500 itself waits differently
+    TEST_ASSERT_EQUAL_INT(1, grow);
+    TEST_ASSERT_EQUAL_INT(1, shrink);
+    bursts[500] = 9;
+    assert_matches_rr(bursts, plen, 4);
+    TEST_ASSERT_EQUAL_INT(-1, rr_inc_set(engine, plen, 3));
+    free(bursts);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_analytic_run_example);
+    RUN_TEST(test_analytic_run_matches_rr);
+    RUN_TEST(test_inc_set_example);
+    RUN_TEST(test_inc_random_updates_match_rr);
+    RUN_TEST(test_inc_update_touches_few);
+    return UNITY_END();
+}
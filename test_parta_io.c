@@ -0,0 +1,102 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_io.h"
+#include <stdlib.h> // For malloc/free
+
+static struct io_workload* w = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    w = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    io_free(w);
+}
+
+void test_io_init(void) {
+    // When: P0 = CPU 2, I/O 5, CPU 2; P1 = CPU 3
+    w = io_init((int[]){2, 5, 2, 3}, (int[]){3, 1}, 2);
+
+    // Then
+    TEST_ASSERT_NOT_NULL(w);
+    TEST_ASSERT_EQUAL_INT(2, w->plen);
+    TEST_ASSERT_EQUAL_INT(0, w->start[0]);
+    TEST_ASSERT_EQUAL_INT(3, w->start[1]);
+    TEST_ASSERT_EQUAL_INT(4, w->start[2]);
+    TEST_ASSERT_EQUAL_INT(3, w->phases[3]);
+}
+void test_io_fcfs_overlap(void) {
+    // When
+    struct pcb procs[2];
+    struct io_stats stats;
+    w = io_init((int[]){2, 5, 2, 3}, (int[]){3, 1}, 2);
+    TEST_ASSERT_NOT_NULL(w);
+    int total_time = io_fcfs_run(w, procs, &stats);
+
+    // Then: P0 | P1 (overlaps P0's I/O) | idle | P0
+    TEST_ASSERT_EQUAL_INT(9, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(2, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(7, stats.busy);
+    TEST_ASSERT_EQUAL_INT(2, stats.completed);
+    TEST_ASSERT_EQUAL_FLOAT(7.0 / 9.0, stats.utilization);
+    TEST_ASSERT_EQUAL_FLOAT(2.0 / 9.0, stats.throughput);
+}
+void test_io_rr_overlap(void) {
+    // When
+    struct pcb procs[2];
+    struct io_stats stats;
+    w = io_init((int[]){2, 5, 2, 3}, (int[]){3, 1}, 2);
+    TEST_ASSERT_NOT_NULL(w);
+    int total_time = io_rr_run(w, 1, procs, &stats);
+
+    // Then: P0 P1 P0 | P1 P1 | idle | P0 P0
+    TEST_ASSERT_EQUAL_INT(10, total_time);
+    TEST_ASSERT_EQUAL_INT(1, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(2, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(7, stats.busy);
+}
+void test_io_cpu_only_matches_fcfs(void) {
+    // When: single-phase processes behave like fcfs_run / rr_run
+    struct pcb procs[3];
+    w = io_init((int[]){5, 8, 2}, (int[]){1, 1, 1}, 3);
+    TEST_ASSERT_NOT_NULL(w);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(15, io_fcfs_run(w, procs, NULL));
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(5, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(13, procs[2].wait);
+
+    TEST_ASSERT_EQUAL_INT(15, io_rr_run(w, 2, procs, NULL));
+    TEST_ASSERT_EQUAL_INT(6, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(7, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(4, procs[2].wait);
+}
+void test_io_long_idle(void) {
+    // When: one process with a huge I/O gap
+    struct pcb procs[1];
+    struct io_stats stats;
+    w = io_init((int[]){1, 1000000000, 1}, (int[]){3}, 1);
+    TEST_ASSERT_NOT_NULL(w);
+    int total_time = io_rr_run(w, 4, procs, &stats);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(1000000002, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(2, stats.busy);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_io_init);
+    RUN_TEST(test_io_fcfs_overlap);
+    RUN_TEST(test_io_rr_overlap);
+    RUN_TEST(test_io_cpu_only_matches_fcfs);
+    RUN_TEST(test_io_long_idle);
+
+    return UNITY_END();
+}
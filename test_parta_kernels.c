@@ -0,0 +1,179 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_kernels.h"
+#include <stdlib.h> // For malloc/free
+#include <string.h>
+
+#define KPLEN 257
+
+static struct pcb* expect = NULL;
+static struct pcb* actual = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    expect = malloc(sizeof(struct pcb) * KPLEN);
+    actual = malloc(sizeof(struct pcb) * KPLEN);
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(expect);
+    free(actual);
+}
+
+static void fill(struct pcb* procs, unsigned seed) {
+    srand(seed);
+    for (int i = 0; i < KPLEN; i++) {
+        procs[i].pid = i;
+        procs[i].burst_left = rand() % 40 - 5;  // includes done and negative
+        procs[i].wait = rand() % 10;
+        procs[i].priority = 0;
+    }
+}
+
+static void assert_same(void) {
+    for (int i = 0; i < KPLEN; i++) {
+        TEST_ASSERT_EQUAL_INT(expect[i].burst_left, actual[i].burst_left);
+        TEST_ASSERT_EQUAL_INT(expect[i].wait, actual[i].wait);
+    }
+}
+
+void test_kernels_scalar_always_supported(void) {
+    TEST_ASSERT_TRUE(kernel_supported(KERNEL_SCALAR));
+    TEST_ASSERT_NOT_NULL(kernel_variant(KERNEL_SCALAR));
+    TEST_ASSERT_NULL(kernel_variant(KERNEL_ISA_COUNT));
+    TEST_ASSERT_NOT_NULL(kernels());
+}
+void test_kernels_override(void) {
+    TEST_ASSERT_EQUAL_STRING("scalar", kernel_select("scalar")->name);
+    // Unknown names fall back to the best supported variant
+    TEST_ASSERT_EQUAL_PTR(kernel_select(NULL), kernel_select("no-such-isa"));
+}
+void test_kernels_variants_agree(void) {
+    const struct kernel_ops* ref = kernel_variant(KERNEL_SCALAR);
+
+    for (int isa = 0; isa < KERNEL_ISA_COUNT; isa++) {
+        const struct kernel_ops* ops = kernel_variant(isa);
+        if (ops == NULL) {
+            continue;
+        }
+
+        fill(expect, 3);
+        fill(actual, 3);
+        ref->wait_update(expect, KPLEN, 7, 4);
+        ops->wait_update(actual, KPLEN, 7, 4);
+        assert_same();
+
+        TEST_ASSERT_EQUAL_INT(ref->fcfs_prefix(expect, KPLEN), ops->fcfs_prefix(actual, KPLEN));
+        assert_same();
+
+        fill(expect, 5);
+        fill(actual, 5);
+        TEST_ASSERT_EQUAL_INT(ref->rr_skip(expect, KPLEN, 3), ops->rr_skip(actual, KPLEN, 3));
+        assert_same();
+    }
+}
+void test_kernels_soa_matches_aos(void) {
+    const struct kernel_ops* ref = kernel_variant(KERNEL_SCALAR);
+
+    for (int isa = 0; isa < KERNEL_ISA_COUNT; isa++) {
+        const struct kernel_ops* ops = kernel_variant(isa);
+        if (ops == NULL) {
+            continue;
+        }
+
+        struct pcb_soa soa;
+        fill(expect, 11);
+        fill(actual, 11);
+        TEST_ASSERT_TRUE(pcb_soa_init(&soa, actual, KPLEN));
+        ref->wait_update(expect, KPLEN, KPLEN - 1, 6);
+        ops->wait_update_soa(&soa, KPLEN - 1, 6);
+        pcb_soa_store(&soa, actual);
+        pcb_soa_free(&soa);
+        assert_same();
+    }
+}
+void test_kernels_wait_update_matches_run_proc(void) {
+    // Set up PCBs [5, 0, 2, -1] current 0, amount 2
+    struct pcb procs[] = { { 0, 3, 0, 0 }, { 1, 0, 0, 0 }, { 2, 2, 0, 0 }, { 3, -1, 0, 0 } };
+    kernels()->wait_update(procs, 4, 0, 2);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(2, procs[2].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[3].wait);
+}
+void test_kernels_rr_skip(void) {
+    // Set up PCBs [9, 10, 0] quantum 4: one full round can be skipped
+    struct pcb procs[] = { { 0, 9, 0, 0 }, { 1, 10, 0, 0 }, { 2, 0, 0, 0 } };
+    TEST_ASSERT_EQUAL_INT(16, kernels()->rr_skip(procs, 3, 4));
+    TEST_ASSERT_EQUAL_INT(1, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(8, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(2, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(8, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].wait);
+
+    // Nothing more to skip: P0 finishes in the next round
+    TEST_ASSERT_EQUAL_INT(0, kernels()->rr_skip(procs, 3, 4));
+}
+void test_rr_long_bursts(void) {
+    // When: RR(1) over two 100M bursts finishes without 200M slices
+    struct pcb* procs = init_procs((int[]){100000000, 100000000}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = rr_run(procs, 2, 1);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(200000000, total_time);
+    TEST_ASSERT_EQUAL_INT(99999999, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(100000000, procs[1].wait);
+    free(procs);
+}
+void test_rr_small_matches_generic(void) {
+    int quanta[] = { 1, 2, 3, 5, 16 };
+    for (int t = 0; t < 200; t++) {
+        // Given: up to 64 processes, and the same ones padded to 65 with
+        // empty processes so rr_run takes the generic path
+        int plen = 1 + t % RR_SMALL_MAX;
+        int quantum = quanta[t % 5];
+        fill(expect, t);
+        for (int i = plen; i < RR_SMALL_MAX + 1; i++) {
+            expect[i].burst_left = 0;
+        }
+        memcpy(actual, expect, sizeof(struct pcb) * plen);
+
+        // When
+        int generic = rr_run(expect, RR_SMALL_MAX + 1, quantum);
+        int small = rr_run(actual, plen, quantum);
+
+        // Then
+        TEST_ASSERT_EQUAL_INT(generic, small);
+        TEST_ASSERT_EQUAL_MEMORY(expect, actual, sizeof(struct pcb) * plen);
+    }
+}
+void test_rr_small_next(void) {
+    // Set up PCBs [0, 3, 0, 2] padded with empty ones to 64
+    struct pcb procs[RR_SMALL_MAX] = { { 0, 0, 0, 0 }, { 1, 3, 0, 0 }, { 2, 0, 0, 0 }, { 3, 2, 0, 0 } };
+    TEST_ASSERT_EQUAL_INT(1, rr_next(-1, procs, 4));
+    TEST_ASSERT_EQUAL_INT(3, rr_next(1, procs, 4));
+    TEST_ASSERT_EQUAL_INT(1, rr_next(3, procs, 4));
+    TEST_ASSERT_EQUAL_INT(1, rr_next(3, procs, RR_SMALL_MAX));
+    procs[63].burst_left = 1;
+    TEST_ASSERT_EQUAL_INT(63, rr_next(3, procs, RR_SMALL_MAX));
+    TEST_ASSERT_EQUAL_INT(1, rr_next(63, procs, RR_SMALL_MAX));
+    procs[1].burst_left = procs[3].burst_left = procs[63].burst_left = 0;
+    TEST_ASSERT_EQUAL_INT(-1, rr_next(0, procs, RR_SMALL_MAX));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_kernels_scalar_always_supported);
+    RUN_TEST(test_kernels_override);
+    RUN_TEST(test_kernels_variants_agree);
+    RUN_TEST(test_kernels_soa_matches_aos);
+    RUN_TEST(test_kernels_wait_update_matches_run_proc);
+    RUN_TEST(test_kernels_rr_skip);
+    RUN_TEST(test_rr_long_bursts);
+    RUN_TEST(test_rr_small_matches_generic);
+    RUN_TEST(test_rr_small_next);
+
+    return UNITY_END();
+}
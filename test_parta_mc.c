@@ -0,0 +1,140 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_mc.h"
+#include <stdlib.h> // For malloc/free
+#include <string.h>
+
+static struct mc_result* result = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    result = malloc(sizeof(struct mc_result));
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(result);
+}
+
+static struct mc_config config_for(const char* spec, const char* dist, int plen) {
+    struct mc_config config = { { NULL, 0 }, { MC_UNIFORM, 1, 1, 0 }, plen, 1000, 0.0, 1, 7 };
+    TEST_ASSERT_TRUE(sched_parse_spec(spec, &config.spec));
+    TEST_ASSERT_TRUE(mc_parse_dist(dist, &config.dist));
+    return config;
+}
+
+void test_mc_parse_dist(void) {
+    struct mc_dist dist;
+    TEST_ASSERT_TRUE(mc_parse_dist("uniform:1:20", &dist));
+    TEST_ASSERT_EQUAL_INT(MC_UNIFORM, dist.kind);
+    TEST_ASSERT_EQUAL_INT(1, dist.lo);
+    TEST_ASSERT_EQUAL_INT(20, dist.hi);
+    TEST_ASSERT_TRUE(mc_parse_dist("bimodal:2:100:10", &dist));
+    TEST_ASSERT_EQUAL_INT(MC_BIMODAL, dist.kind);
+    TEST_ASSERT_EQUAL_INT(10, dist.pct);
+    TEST_ASSERT_FALSE(mc_parse_dist("uniform:0:20", &dist));
+    TEST_ASSERT_FALSE(mc_parse_dist("uniform:5:4", &dist));
+    TEST_ASSERT_FALSE(mc_parse_dist("uniform:1", &dist));
+    TEST_ASSERT_FALSE(mc_parse_dist("uniform:1:2:3", &dist));
+    TEST_ASSERT_FALSE(mc_parse_dist("bimodal:1:2:101", &dist));
+    TEST_ASSERT_FALSE(mc_parse_dist("normal:1:2", &dist));
+    TEST_ASSERT_FALSE(mc_parse_dist("uniform:1:x", &dist));
+}
+
+void test_mc_workload_streams(void) {
+    // Given
+    struct mc_dist dist = { MC_UNIFORM, 3, 9, 0 };
+    int a[200], b[200], c[200];
+
+    // When: workload 5 twice, then workload 6
+    mc_workload(&dist, 1, 5, a, 200);
+    mc_workload(&dist, 1, 5, b, 200);
+    mc_workload(&dist, 1, 6, c, 200);
+
+    // Then: reproducible, in range, and a different stream
+    TEST_ASSERT_EQUAL_MEMORY(a, b, sizeof(a));
+    int same = 0;
+    int seen[10] = { 0 };
+    for (int i = 0; i < 200; i++) {
+        TEST_ASSERT_TRUE(a[i] >= 3 && a[i] <= 9);
+        seen[a[i]]++;
+        same += (a[i] == c[i]);
+    }
+    TEST_ASSERT_TRUE(same < 60); // ~200 / 7 expected
+    for (int v = 3; v <= 9; v++) {
+        TEST_ASSERT_TRUE(seen[v] > 0);
+    }
+}
+
+void test_mc_constant_workload_converges(void) {
+    // Given: every workload is [5, 5, 5], FCFS waits 0, 5, 10
+    struct mc_config config = config_for("fcfs", "uniform:5:5", 3);
+    config.ci_target = 0.01;
+
+    // When
+    bool ok = mc_run(&config, result);
+
+    // Then: zero variance, so the first batch is enough
+    TEST_ASSERT_TRUE(ok);
+    TEST_ASSERT_TRUE(result->converged);
+    TEST_ASSERT_EQUAL_INT(MC_BATCH, result->runs);
+    TEST_ASSERT_TRUE(result->avg_wait.mean == 5.0);
+    TEST_ASSERT_TRUE(welford_ci95(&result->avg_wait) == 0.0);
+    TEST_ASSERT_TRUE(result->total.mean == 15.0);
+    TEST_ASSERT_EQUAL_INT(3 * MC_BATCH, result->waits.count);
+    TEST_ASSERT_EQUAL_INT(10, sketch_quantile(&result->waits, 0.99));
+}
+
+void test_mc_threads_agree(void) {
+    // Given: the same run on one and on four threads
+    struct mc_config config = config_for("rr:4", "bimodal:2:60:20", 40);
+    struct mc_result* single = malloc(sizeof(struct mc_result));
+    config.max_runs = 700;
+
+    // When
+    bool ok = mc_run(&config, single);
+    config.threads = 4;
+    ok = ok && mc_run(&config, result);
+
+    // Then: the same workloads, merged in another order
+    TEST_ASSERT_TRUE(ok);
+    TEST_ASSERT_EQUAL_INT(700, single->runs);
+    TEST_ASSERT_EQUAL_INT(700, result->runs);
+    TEST_ASSERT_FALSE(result->converged);
+    TEST_ASSERT_EQUAL_MEMORY(&single->waits, &result->waits, sizeof(struct wait_sketch));
+    double diff = single->avg_wait.mean - result->avg_wait.mean;
+    TEST_ASSERT_TRUE(diff < 1e-9 && -diff < 1e-9);
+    TEST_ASSERT_EQUAL_INT(single->total.n, result->total.n);
+    free(single);
+}
+
+void test_mc_stops_at_ci_target(void) {
+    // Given: a noisy workload and a loose, then a tight, target
+    struct mc_config config = config_for("fcfs", "uniform:1:100", 20);
+    config.max_runs = 100000;
+    config.threads = 3;
+    config.ci_target = 50.0;
+
+    // When
+    bool ok = mc_run(&config, result);
+
+    // Then
+    TEST_ASSERT_TRUE(ok);
+    TEST_ASSERT_TRUE(result->converged);
+    TEST_ASSERT_EQUAL_INT(MC_BATCH, result->runs);
+
+    config.ci_target = 2.0;
+    TEST_ASSERT_TRUE(mc_run(&config, result));
+    TEST_ASSERT_TRUE(result->converged);
+    TEST_ASSERT_TRUE(result->runs > MC_BATCH && result->runs < config.max_runs);
+    TEST_ASSERT_TRUE(welford_ci95(&result->avg_wait) <= 2.0);
+    TEST_ASSERT_TRUE(result->avg_wait.mean > 400.0 && result->avg_wait.mean < 560.0); // 19 * 50.5 / 2
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_mc_parse_dist);
+    RUN_TEST(test_mc_workload_streams);
+    RUN_TEST(test_mc_constant_workload_converges);
+    RUN_TEST(test_mc_threads_agree);
+    RUN_TEST(test_mc_stops_at_ci_target);
+    return UNITY_END();
+}
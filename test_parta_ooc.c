@@ -0,0 +1,139 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_ooc.h"
+#include "parta_inc.h"
+#include <stdlib.h> // For malloc/free
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+static char dir[] = "/tmp/parta_ooc_test_XXXXXX";
+
+void setUp(void) {
+    // Code to execute at test start up
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+}
+
+/** Write bursts as text to an unlinked temporary file, rewound. */
+static FILE* bursts_file(const int* bursts, int plen) {
+    FILE* f = tmpfile();
+    for (int i = 0; i < plen; i++) {
+        fprintf(f, "%d\n", bursts[i]);
+    }
+    fflush(f);
+    rewind(f);
+    return f;
+}
+
+/** Run rr_ooc_run and check every wait against rr_analytic_run. */
+static void assert_matches_rr(const int* bursts, int plen, int quantum, size_t mem,
+                              struct ooc_result* result) {
+    FILE* in = bursts_file(bursts, plen);
+    FILE* waits = tmpfile();
+    struct out_buf out;
+    out_init(&out, fileno(waits), 1 << 16);
+    struct ooc_config config = { dir, mem };
+
+    TEST_ASSERT_EQUAL_INT(STREAM_OK, rr_ooc_run(fileno(in), quantum, &config, &out, result));
+    out_free(&out);
+
+    struct pcb* procs = init_procs((int*)bursts, plen);
+    int total = rr_analytic_run(procs, plen, quantum);
+    TEST_ASSERT_TRUE(result->total_time == total);
+    TEST_ASSERT_TRUE(result->plen == plen);
+
+    rewind(waits);
+    long long sum = 0;
+    for (int i = 0; i < plen; i++) {
+        long long pid, wait;
+        TEST_ASSERT_EQUAL_INT(2, fscanf(waits, "%lld %lld", &pid, &wait));
+        TEST_ASSERT_TRUE(pid == i);
+        TEST_ASSERT_TRUE(wait == procs[i].wait);
+        sum += wait;
+    }
+    TEST_ASSERT_TRUE(result->avg_wait == (double)sum / plen);
+    free(procs);
+    fclose(in);
+    fclose(waits);
+}
+
+void test_ooc_example(void) {
+    // Given
+    int bursts[] = { 5, 8, 2 };
+    struct ooc_result result;
+
+    // When / Then: waits 6, 7, 8 like rr_run
+    assert_matches_rr(bursts, 3, 4, 1 << 20, &result);
+    TEST_ASSERT_TRUE(result.total_time == 15);
+    TEST_ASSERT_TRUE(result.p99_wait == 8);
+    TEST_ASSERT_EQUAL_INT(1, result.runs);
+    TEST_ASSERT_EQUAL_INT(1, result.bands);
+}
+
+void test_ooc_small_budget_spills(void) {
+    // Given: far more bursts and levels than the minimum budget holds
+    int plen = 50000;
+    int* bursts = malloc(sizeof(int) * plen);
+    unsigned int seed = 7;
+    for (int i = 0; i < plen; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bursts[i] = (int)((seed >> 8) % 20000) * (i % 50 != 0); // Some absent
+    }
+    struct ooc_result result;
+
+    // When: quantum 1 makes every distinct burst its own level
+    assert_matches_rr(bursts, plen, 1, 0, &result);
+
+    // Then: several runs (merged in more than one pass) and several bands
+    TEST_ASSERT_TRUE(result.runs > 2);
+    TEST_ASSERT_TRUE(result.bands > 1);
+    free(bursts);
+}
+
+void test_ooc_quanta(void) {
+    int quanta[] = { 2, 3, 7, 100 };
+    int plen = 3000;
+    int* bursts = malloc(sizeof(int) * plen);
+    for (int t = 0; t < 4; t++) {
+        // Given
+        for (int i = 0; i < plen; i++) {
+            bursts[i] = (i * 7919 + t) % 997;
+        }
+        struct ooc_result result;
+
+        // When / Then
+        assert_matches_rr(bursts, plen, quanta[t], 0, &result);
+    }
+    free(bursts);
+}
+
+void test_ooc_bad_input(void) {
+    // Given
+    FILE* in = tmpfile();
+    fputs("5 8 2 oops 4", in);
+    fflush(in);
+    rewind(in);
+    struct ooc_config config = { dir, 0 };
+    struct ooc_result result;
+
+    // When
+    enum stream_status status = rr_ooc_run(fileno(in), 4, &config, NULL, &result);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(STREAM_EINPUT, status);
+    TEST_ASSERT_TRUE(result.plen == 3);
+    fclose(in);
+}
+
+int main(void) {
+    TEST_ASSERT_NOT_NULL(mkdtemp(dir));
+    UNITY_BEGIN();
+    RUN_TEST(test_ooc_example);
+    RUN_TEST(test_ooc_small_budget_spills);
+    RUN_TEST(test_ooc_quanta);
+    RUN_TEST(test_ooc_bad_input);
+    int failures = UNITY_END();
+    rmdir(dir); // Spill files are unlinked as soon as they are created
+    return failures;
+}
@@ -0,0 +1,207 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_opt.h"
+#include <stdlib.h> // For malloc/free
+
+void setUp(void) {
+    // Code to execute at test start up
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+}
+
+static unsigned int seed = 4242;
+
+static int next_burst(int max) {
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 8) % (unsigned int)(max + 1)); // 0 .. max, 0 is absent
+}
+
+/**
+ * Score every quantum in [1, hi] the slow way, with rr_run_cost; dispatch
+ * 0 is plain Round-Robin. Fills the best (largest on ties) quantum and
+ * its summed wait or p99.
+ */
+static void brute_force(const int* bursts, int plen, int hi, int dispatch, bool p99,
+                        int* best_q, long long* best) {
+    struct switch_cost cost = { dispatch, 0, 0 };
+    for (int q = 1; q <= hi; q++) {
+        struct pcb* procs = init_procs((int*)bursts, plen);
+        rr_run_cost(procs, plen, q, &cost, NULL);
+        long long score = 0;
+        if (p99) {
+            struct pcb* sorted = procs;
+            for (int i = 0; i < plen; i++) {
+                for (int j = i + 1; j < plen; j++) {
+                    if (sorted[j].wait < sorted[i].wait) {
+                        struct pcb t = sorted[i];
+                        sorted[i] = sorted[j];
+                        sorted[j] = t;
+                    }
+                }
+            }
+            score = sorted[(99 * plen + 99) / 100 - 1].wait;
+        } else {
+            for (int i = 0; i < plen; i++) {
+                score += procs[i].wait;
+            }
+        }
+        if (q == 1 || score <= *best) {
+            *best = score;
+            *best_q = q;
+        }
+        free(procs);
+    }
+}
+
+void test_opt_example(void) {
+    // Given: [5, 8, 2]; RR(1), RR(2) and RR(5) all wait 17 in total, any
+    // other quantum longer, and ties go to the larger quantum
+    int bursts[] = { 5, 8, 2 };
+    struct pcb* procs = init_procs(bursts, 3);
+    struct opt_config config = { OPT_MEAN_WAIT, 0, 0, 0 };
+    struct opt_result result;
+
+    // When
+    bool ok = rr_optimize(procs, 3, &config, &result);
+
+    // Then
+    TEST_ASSERT_TRUE(ok);
+    TEST_ASSERT_EQUAL_INT(5, result.quantum);
+    TEST_ASSERT_TRUE(result.score == 17.0 / 3);
+    TEST_ASSERT_TRUE(result.avg_wait == result.score);
+    TEST_ASSERT_EQUAL_INT(15, result.total_time);
+    TEST_ASSERT_EQUAL_INT(8, result.range);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait); // Input untouched
+    free(procs);
+}
+
+void test_opt_mean_matches_brute_force(void) {
+    for (int t = 0; t < 60; t++) {
+        // Given
+        int plen = 1 + t % 12;
+        int bursts[12];
+        int max = 1;
+        for (int i = 0; i < plen; i++) {
+            bursts[i] = next_burst(5 + t * 2);
+            max = (bursts[i] > max) ? bursts[i] : max;
+        }
+        struct pcb* procs = init_procs(bursts, plen);
+        struct opt_config config = { OPT_MEAN_WAIT, 0, 0, 0 };
+        struct opt_result result;
+        int best_q;
+        long long best;
+
+        // When
+        bool ok = rr_optimize(procs, plen, &config, &result);
+        brute_force(bursts, plen, max, 0, false, &best_q, &best);
+
+        // Then
+        TEST_ASSERT_TRUE(ok);
+        TEST_ASSERT_EQUAL_INT(best_q, result.quantum);
+        TEST_ASSERT_TRUE(result.score == (double)best / plen);
+        TEST_ASSERT_TRUE(result.candidates <= result.range);
+        free(procs);
+    }
+}
+
+void test_opt_switch_matches_rr_cost(void) {
+    int dispatch[] = { 1, 2, 5 };
+    for (int t = 0; t < 60; t++) {
+        // Given
+        int plen = 1 + t % 10;
+        int bursts[10];
+        int max = 1;
+        for (int i = 0; i < plen; i++) {
+            bursts[i] = next_burst(4 + t);
+            max = (bursts[i] > max) ? bursts[i] : max;
+        }
+        struct pcb* procs = init_procs(bursts, plen);
+        struct opt_config config = { OPT_SWITCH, dispatch[t % 3], 0, 0 };
+        struct opt_result result;
+        int best_q;
+        long long best;
+
+        // When
+        bool ok = rr_optimize(procs, plen, &config, &result);
+        brute_force(bursts, plen, max, dispatch[t % 3], false, &best_q, &best);
+
+        // Then: the score is the mean wait rr_run_cost reports
+        TEST_ASSERT_TRUE(ok);
+        TEST_ASSERT_EQUAL_INT(best_q, result.quantum);
+        TEST_ASSERT_TRUE(result.score == (double)best / plen);
+        struct switch_cost cost = { dispatch[t % 3], 0, 0 };
+        TEST_ASSERT_EQUAL_INT(rr_run_cost(procs, plen, best_q, &cost, NULL), result.total_time);
+        free(procs);
+    }
+}
+
+void test_opt_p99_never_beats_brute_force(void) {
+    for (int t = 0; t < 40; t++) {
+        // Given
+        int plen = 1 + t % 12;
+        int bursts[12];
+        int max = 1;
+        for (int i = 0; i < plen; i++) {
+            bursts[i] = next_burst(6 + t);
+            max = (bursts[i] > max) ? bursts[i] : max;
+        }
+        struct pcb* procs = init_procs(bursts, plen);
+        struct opt_config config = { OPT_P99_WAIT, 0, 0, 0 };
+        struct opt_result result;
+        int best_q;
+        long long best;
+
+        // When
+        bool ok = rr_optimize(procs, plen, &config, &result);
+        brute_force(bursts, plen, max, 0, true, &best_q, &best);
+
+        // Then: the reported p99 is the one at that quantum, which can be
+        // above the optimum where two waits cross between candidates
+        TEST_ASSERT_TRUE(ok);
+        TEST_ASSERT_TRUE(result.score == result.p99_wait);
+        TEST_ASSERT_TRUE(result.p99_wait >= best);
+        free(procs);
+    }
+}
+
+void test_opt_evaluates_breakpoints_only(void) {
+    // Given: one large burst and a few small ones, in a restricted range
+    int bursts[] = { 1000000, 3, 7, 1000000, 12 };
+    struct pcb* procs = init_procs(bursts, 5);
+    struct opt_config config = { OPT_MEAN_WAIT, 0, 0, 0 };
+    struct opt_result result;
+    int* quanta;
+
+    // When
+    bool ok = rr_optimize(procs, 5, &config, &result);
+    int n = rr_quantum_candidates(procs, 5, 10, 20, &quanta);
+
+    // Then: about 4 * sqrt(b) quanta out of a million
+    TEST_ASSERT_TRUE(ok);
+    TEST_ASSERT_EQUAL_INT(1000000, result.range);
+    TEST_ASSERT_TRUE(result.candidates < 4100);
+    TEST_ASSERT_EQUAL_INT(11, n); // Every integer in [10, 20] divides into some burst
+    for (int i = 0; i < n; i++) {
+        TEST_ASSERT_EQUAL_INT(10 + i, quanta[i]);
+    }
+    free(quanta);
+
+    // A range past the largest burst is all FCFS
+    config = (struct opt_config){ OPT_MEAN_WAIT, 0, 2000000, 3000000 };
+    TEST_ASSERT_TRUE(rr_optimize(procs, 5, &config, &result));
+    TEST_ASSERT_EQUAL_INT(2000000, result.quantum);
+    TEST_ASSERT_EQUAL_INT(1, result.candidates);
+    config.max_quantum = 1;
+    TEST_ASSERT_FALSE(rr_optimize(procs, 5, &config, &result));
+    free(procs);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_opt_example);
+    RUN_TEST(test_opt_mean_matches_brute_force);
+    RUN_TEST(test_opt_switch_matches_rr_cost);
+    RUN_TEST(test_opt_p99_never_beats_brute_force);
+    RUN_TEST(test_opt_evaluates_breakpoints_only);
+    return UNITY_END();
+}
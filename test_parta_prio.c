@@ -0,0 +1,127 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+
+static void set_prios(int* prios, int plen) {
+    for (int i = 0; i < plen; i++) {
+        procs[i].priority = prios[i];
+    }
+}
+
+void test_prio_582(void) {
+    // When: priorities 2, 0, 1
+    procs = init_procs((int[]){5, 8, 2}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    set_prios((int[]){2, 0, 1}, 3);
+    int total_time = prio_run(procs, 3, false, 0);
+
+    // Then: P1 | P2 | P0
+    TEST_ASSERT_EQUAL_INT(15, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(10, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].burst_left);
+    TEST_ASSERT_EQUAL_INT(8, procs[2].wait);
+
+    // Freed in tearDown above
+}
+void test_prio_ties_are_fcfs(void) {
+    // When: all priority 0
+    procs = init_procs((int[]){5, 8, 2}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = prio_run(procs, 3, true, 1);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(15, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(5, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(13, procs[2].wait);
+
+    // Freed in tearDown above
+}
+void test_prio_somedone(void) {
+    // When: P1 has nothing to run
+    procs = init_procs((int[]){5, 0, 2}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    set_prios((int[]){1, 0, 0}, 3);
+    int total_time = prio_run(procs, 3, false, 0);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(7, total_time);
+    TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].wait);
+
+    // Freed in tearDown above
+}
+void test_prio_preempt_no_aging(void) {
+    // When: without aging the low priority process waits for the whole burst
+    procs = init_procs((int[]){10, 2}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    set_prios((int[]){2, 5}, 2);
+    int total_time = prio_run(procs, 2, true, 0);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(12, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(10, procs[1].wait);
+
+    // Freed in tearDown above
+}
+void test_prio_preempt_aging(void) {
+    // When: P1 ages 5 -> 1 by t=8 and preempts P0 (priority 2)
+    procs = init_procs((int[]){10, 2}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    set_prios((int[]){2, 5}, 2);
+    int total_time = prio_run(procs, 2, true, 2);
+
+    // Then: P0 8 | P1 2 | P0 2
+    TEST_ASSERT_EQUAL_INT(12, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(8, procs[1].wait);
+
+    // Freed in tearDown above
+}
+void test_prio_aging_keeps_order(void) {
+    // When: aging lifts P1 and P2 to level 0 but keeps P2 (better) first
+    procs = init_procs((int[]){10, 3, 3}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    set_prios((int[]){0, 2, 1}, 3);
+    int total_time = prio_run(procs, 3, false, 5);
+
+    // Then: P0 | P2 | P1
+    TEST_ASSERT_EQUAL_INT(16, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(13, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(10, procs[2].wait);
+
+    // Freed in tearDown above
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_prio_582);
+    RUN_TEST(test_prio_ties_are_fcfs);
+    RUN_TEST(test_prio_somedone);
+    RUN_TEST(test_prio_preempt_no_aging);
+    RUN_TEST(test_prio_preempt_aging);
+    RUN_TEST(test_prio_aging_keeps_order);
+
+    return UNITY_END();
+}
@@ -0,0 +1,105 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+
+void test_switch_cost_ticks(void) {
+    struct switch_cost cost = { 1, 3, 2 };
+    TEST_ASSERT_EQUAL_INT(4, switch_cost_ticks(&cost, 0, true));
+    TEST_ASSERT_EQUAL_INT(1, switch_cost_ticks(&cost, 1, false));
+    TEST_ASSERT_EQUAL_INT(3, switch_cost_ticks(&cost, 5, false));
+    TEST_ASSERT_EQUAL_INT(4, switch_cost_ticks(&cost, 100, false));
+    TEST_ASSERT_EQUAL_INT(0, switch_cost_ticks(NULL, 100, true));
+}
+void test_rr_cost_free_matches_rr(void) {
+    // When: no cost model
+    struct switch_stats stats;
+    procs = init_procs((int[]){5, 8, 2}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = rr_run_cost(procs, 3, 4, NULL, &stats);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(15, total_time);
+    TEST_ASSERT_EQUAL_INT(6, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(7, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(8, procs[2].wait);
+    TEST_ASSERT_EQUAL_INT(15, stats.useful);
+    TEST_ASSERT_EQUAL_INT(0, stats.overhead);
+    TEST_ASSERT_EQUAL_INT(5, stats.switches);
+
+    // Freed in tearDown above
+}
+void test_rr_cost_dispatch(void) {
+    // When: 1 tick per switch, RR(4) over 5, 8
+    struct switch_cost cost = { 1, 0, 0 };
+    struct switch_stats stats;
+    procs = init_procs((int[]){5, 8}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = rr_run_cost(procs, 2, 4, &cost, &stats);
+
+    // Then: s P0 s P1 s P0 s P1
+    TEST_ASSERT_EQUAL_INT(17, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(7, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(9, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(13, stats.useful);
+    TEST_ASSERT_EQUAL_INT(4, stats.overhead);
+    TEST_ASSERT_EQUAL_INT(4, stats.switches);
+
+    // Freed in tearDown above
+}
+void test_rr_cost_cache(void) {
+    // When: dispatch 1, refill up to 3 ticks, one tick per 2 away
+    struct switch_cost cost = { 1, 3, 2 };
+    struct switch_stats stats;
+    procs = init_procs((int[]){5, 8}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = rr_run_cost(procs, 2, 4, &cost, &stats);
+
+    // Then: cold starts cost 4, P0 returns after 8 (cost 4), P1 after 5 (cost 3)
+    TEST_ASSERT_EQUAL_INT(28, total_time);
+    TEST_ASSERT_EQUAL_INT(13, stats.useful);
+    TEST_ASSERT_EQUAL_INT(15, stats.overhead);
+    TEST_ASSERT_EQUAL_INT(4, stats.switches);
+
+    // Freed in tearDown above
+}
+void test_rr_cost_no_self_switch(void) {
+    // When: a single process keeps the CPU across quanta
+    struct switch_cost cost = { 2, 0, 0 };
+    struct switch_stats stats;
+    procs = init_procs((int[]){9}, 1);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = rr_run_cost(procs, 1, 2, &cost, &stats);
+
+    // Then: only the initial dispatch is charged
+    TEST_ASSERT_EQUAL_INT(11, total_time);
+    TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(1, stats.switches);
+
+    // Freed in tearDown above
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_switch_cost_ticks);
+    RUN_TEST(test_rr_cost_free_matches_rr);
+    RUN_TEST(test_rr_cost_dispatch);
+    RUN_TEST(test_rr_cost_cache);
+    RUN_TEST(test_rr_cost_no_self_switch);
+
+    return UNITY_END();
+}
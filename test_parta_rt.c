@@ -0,0 +1,123 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_rt.h"
+#include <stdlib.h> // For malloc/free
+
+void setUp(void) {
+    // Code to execute at test start up (currently empty)
+}
+void tearDown(void) {
+    // Code to execute at test conclusion (currently empty)
+}
+
+void test_rt_hyperperiod(void) {
+    struct rt_task tasks[] = { { 4, 1, 0, 0, 0 }, { 6, 2, 0, 0, 0 }, { 10, 1, 0, 0, 0 } };
+    TEST_ASSERT_EQUAL_INT(60, (int)rt_hyperperiod(tasks, 3));
+
+    struct rt_task bad[] = { { 0, 1, 0, 0, 0 } };
+    TEST_ASSERT_EQUAL_INT(-1, (int)rt_hyperperiod(bad, 1));
+}
+void test_rt_analysis_rejects_bad_tasks(void) {
+    // A zero period would divide by zero; a zero WCET is no task at all
+    struct rt_task zero_period[] = { { 4, 1, 0, 0, 0 }, { 0, 1, 0, 0, 0 } };
+    struct rt_task zero_wcet[] = { { 4, 1, 0, 0, 0 }, { 6, 0, 0, 0, 0 } };
+    int response[2];
+
+    TEST_ASSERT_FALSE(rt_rm_rta(zero_period, 2, response));
+    TEST_ASSERT_FALSE(rt_rm_rta(zero_wcet, 2, response));
+    TEST_ASSERT_TRUE(rt_utilization(zero_period, 2) == -1.0);
+    TEST_ASSERT_TRUE(rt_utilization(zero_wcet, 2) == -1.0);
+    TEST_ASSERT_FALSE(rt_rm_bound(zero_period, 2));
+    TEST_ASSERT_FALSE(rt_edf_test(zero_period, 2));
+    TEST_ASSERT_FALSE(rt_edf_test(zero_wcet, 2));
+    TEST_ASSERT_TRUE(rt_utilization(zero_period, 1) == 0.25);
+}
+void test_rt_schedulability(void) {
+    // U = 0.9, RM feasible by RTA but not by the utilization bound
+    struct rt_task tasks[] = { { 4, 1, 0, 0, 0 }, { 5, 2, 0, 0, 0 }, { 20, 5, 0, 0, 0 } };
+    int response[3];
+
+    TEST_ASSERT_FALSE(rt_rm_bound(tasks, 3));
+    TEST_ASSERT_TRUE(rt_edf_test(tasks, 3));
+    TEST_ASSERT_TRUE(rt_rm_rta(tasks, 3, response));
+    TEST_ASSERT_EQUAL_INT(1, response[0]);
+    TEST_ASSERT_EQUAL_INT(3, response[1]);
+    TEST_ASSERT_EQUAL_INT(15, response[2]);
+}
+void test_rt_edf_vs_rm(void) {
+    // U = 1: EDF meets every deadline, RM misses
+    struct rt_task tasks[] = { { 4, 2, 0, 0, 0 }, { 6, 3, 0, 0, 0 } };
+    struct pcb procs[2];
+    int task_misses[2];
+    struct rt_stats stats = { 0 };
+    stats.task_misses = task_misses;
+
+    TEST_ASSERT_FALSE(rt_rm_rta(tasks, 2, NULL));
+    TEST_ASSERT_TRUE(rt_edf_test(tasks, 2));
+
+    int t = rt_run(tasks, 2, RT_EDF, 0, 1, procs, &stats);
+    TEST_ASSERT_EQUAL_INT(12, t);
+    TEST_ASSERT_EQUAL_INT(5, stats.jobs);
+    TEST_ASSERT_EQUAL_INT(5, stats.done);
+    TEST_ASSERT_EQUAL_INT(0, stats.misses);
+    TEST_ASSERT_EQUAL_INT(12, stats.busy);
+
+    t = rt_run(tasks, 2, RT_RM, 0, 1, procs, &stats);
+    TEST_ASSERT_EQUAL_INT(12, t);
+    TEST_ASSERT_TRUE(stats.misses > 0);
+    TEST_ASSERT_EQUAL_INT(0, task_misses[0]);
+    TEST_ASSERT_EQUAL_INT(stats.misses, task_misses[1]);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].priority);
+    TEST_ASSERT_EQUAL_INT(1, procs[1].priority);
+}
+void test_rt_waits(void) {
+    // RM over [0, 12): P0 never waits, P1's first job waits behind P0
+    struct rt_task tasks[] = { { 4, 1, 0, 0, 0 }, { 6, 2, 0, 0, 0 } };
+    struct pcb procs[2];
+    struct rt_stats stats = { 0 };
+
+    int t = rt_run(tasks, 2, RT_RM, 0, 1, procs, &stats);
+    TEST_ASSERT_EQUAL_INT(12, t);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(1, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(7, stats.busy);
+}
+void test_rt_idle_skipped(void) {
+    // A long, mostly idle hyperperiod only costs a handful of events
+    struct rt_task tasks[] = { { 1000000, 1, 0, 0, 0 }, { 500000, 1, 0, 0, 0 } };
+    struct pcb procs[2];
+    struct rt_stats stats = { 0 };
+
+    int t = rt_run(tasks, 2, RT_EDF, 0, 1, procs, &stats);
+    TEST_ASSERT_EQUAL_INT(1000000, t);
+    TEST_ASSERT_EQUAL_INT(3, stats.jobs);
+    TEST_ASSERT_EQUAL_INT(6, stats.events);
+    TEST_ASSERT_EQUAL_INT(0, stats.misses);
+}
+void test_rt_sporadic(void) {
+    // Sporadic releases are never closer than the minimum inter-arrival
+    struct rt_task tasks[] = { { 10, 1, 0, 0, 5 } };
+    struct pcb procs[1];
+    struct rt_stats stats = { 0 };
+
+    int t = rt_run(tasks, 1, RT_EDF, 1000, 42, procs, &stats);
+    TEST_ASSERT_EQUAL_INT(1000, t);
+    TEST_ASSERT_TRUE(stats.jobs <= 100);
+    TEST_ASSERT_TRUE(stats.jobs >= 1000 / 15);
+    TEST_ASSERT_EQUAL_INT(0, stats.misses);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_rt_hyperperiod);
+    RUN_TEST(test_rt_schedulability);
+    RUN_TEST(test_rt_analysis_rejects_bad_tasks);
+    RUN_TEST(test_rt_edf_vs_rm);
+    RUN_TEST(test_rt_waits);
+    RUN_TEST(test_rt_idle_skipped);
+    RUN_TEST(test_rt_sporadic);
+
+    return UNITY_END();
+}
@@ -0,0 +1,189 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_server.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static struct parta_server* server = NULL;
+static pthread_t server_thread;
+static char path[64];
+
+static void* serve(void* arg) {
+    server_run(arg);
+    return NULL;
+}
+
+void setUp(void) {
+    // Code to execute at test start up: a server on a private socket
+    snprintf(path, sizeof(path), "/tmp/parta_test_%d.sock", (int)getpid());
+    struct srv_config config = { path, 2, 4, 1 << 20, NULL };
+    server = server_create(&config);
+    TEST_ASSERT_NOT_NULL(server);
+    pthread_create(&server_thread, NULL, serve, server);
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    server_stop(server);
+    pthread_join(server_thread, NULL);
+    server_free(server);
+    TEST_ASSERT_NOT_EQUAL(0, access(path, F_OK));
+}
+
+static struct srv_request request(uint32_t id, const char* algo, int param, uint32_t plen) {
+    struct srv_request req = { 0 };
+    req.req_id = id;
+    strncpy(req.algo, algo, SRV_ALGO_LEN - 1);
+    req.param = param;
+    req.plen = plen;
+    return req;
+}
+
+void test_server_pipelined(void) {
+    // Given
+    int fd = srv_connect(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+    int bursts[] = { 5, 8, 2 };
+
+    // When: three requests before reading any answer
+    struct srv_request fcfs = request(7, "fcfs", 0, 3);
+    struct srv_request rr = request(8, "rr", 2, 3);
+    struct srv_request bad = request(9, "rr", 0, 3);
+    TEST_ASSERT_TRUE(srv_send(fd, &fcfs, bursts, NULL));
+    TEST_ASSERT_TRUE(srv_send(fd, &rr, bursts, NULL));
+    TEST_ASSERT_TRUE(srv_send(fd, &bad, bursts, NULL));
+
+    // Then: answers may come in any order
+    bool seen[3] = { false };
+    for (int i = 0; i < 3; i++) {
+        struct srv_response resp;
+        TEST_ASSERT_TRUE(srv_recv(fd, &resp));
+        TEST_ASSERT_TRUE(resp.req_id >= 7 && resp.req_id <= 9);
+        seen[resp.req_id - 7] = true;
+        if (resp.req_id == 7) {
+            TEST_ASSERT_EQUAL_INT(SRV_OK, resp.status);
+            TEST_ASSERT_EQUAL_INT(15, resp.total_time);
+            TEST_ASSERT_EQUAL_INT(13, resp.p99_wait);
+            TEST_ASSERT_TRUE(resp.avg_wait == 6.0);
+        } else if (resp.req_id == 8) {
+            TEST_ASSERT_EQUAL_INT(SRV_OK, resp.status);
+            TEST_ASSERT_TRUE(resp.avg_wait == 17.0 / 3);
+        } else {
+            TEST_ASSERT_EQUAL_INT(SRV_EALGO, resp.status);
+        }
+    }
+    TEST_ASSERT_TRUE(seen[0] && seen[1] && seen[2]);
+    close(fd);
+}
+
+void test_server_split_frames_and_arena_growth(void) {
+    // Given: more processes than the 4 preallocated per worker
+    int fd = srv_connect(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+    int bursts[10];
+    int prios[10];
+    for (int i = 0; i < 10; i++) {
+        bursts[i] = 1;
+        prios[i] = 9 - i;
+    }
+
+    // When: the frame arrives one byte at a time through a socket pair
+    int pair[2];
+    TEST_ASSERT_EQUAL_INT(0, socketpair(AF_UNIX, SOCK_STREAM, 0, pair));
+    struct srv_request req = request(1, "prio", 0, 10);
+    TEST_ASSERT_TRUE(srv_send(pair[0], &req, bursts, prios));
+    close(pair[0]);
+    char byte;
+    while (read(pair[1], &byte, 1) == 1) {
+        TEST_ASSERT_EQUAL_INT(1, write(fd, &byte, 1));
+    }
+    close(pair[1]);
+
+    // Then: P9 runs first, P0 last
+    struct srv_response resp;
+    TEST_ASSERT_TRUE(srv_recv(fd, &resp));
+    TEST_ASSERT_EQUAL_INT(SRV_OK, resp.status);
+    TEST_ASSERT_EQUAL_INT(10, resp.total_time);
+    TEST_ASSERT_EQUAL_INT(9, resp.p99_wait);
+    TEST_ASSERT_TRUE(resp.avg_wait == 4.5);
+    close(fd);
+}
+
+void test_server_half_close(void) {
+    // Given
+    int fd = srv_connect(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+    int bursts[] = { 3 };
+    struct srv_request req = request(42, "sjf", 0, 1);
+
+    // When: the client stops sending before reading
+    TEST_ASSERT_TRUE(srv_send(fd, &req, bursts, NULL));
+    shutdown(fd, SHUT_WR);
+
+    // Then: the answer still arrives, then the server closes
+    struct srv_response resp;
+    TEST_ASSERT_TRUE(srv_recv(fd, &resp));
+    TEST_ASSERT_EQUAL_UINT32(42, resp.req_id);
+    TEST_ASSERT_EQUAL_INT(3, resp.total_time);
+    TEST_ASSERT_FALSE(srv_recv(fd, &resp));
+    close(fd);
+}
+
+void test_server_half_close_during_delivery(void) {
+    // Given: clients that half-close after a request and hang up a little
+    // later, so the hang-up races the delivery of the answer (and may
+    // arrive in the same epoll batch, after it)
+    int bursts[] = { 4, 1, 3 };
+    for (int round = 0; round < 400; round++) {
+        int fd = srv_connect(path);
+        TEST_ASSERT_TRUE(fd >= 0);
+        struct srv_request req = request((uint32_t)round, "sjf", 0, 3);
+
+        // When
+        TEST_ASSERT_TRUE(srv_send(fd, &req, bursts, NULL));
+        shutdown(fd, SHUT_WR);
+        for (volatile int spin = 0; spin < (round % 40) * 500; spin++) {
+        }
+        close(fd);
+    }
+
+    // Then: the server is still up and answers a client that waits
+    int fd = srv_connect(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+    struct srv_request req = request(999, "fcfs", 0, 3);
+    TEST_ASSERT_TRUE(srv_send(fd, &req, bursts, NULL));
+    shutdown(fd, SHUT_WR);
+    struct srv_response resp;
+    TEST_ASSERT_TRUE(srv_recv(fd, &resp));
+    TEST_ASSERT_EQUAL_UINT32(999, resp.req_id);
+    TEST_ASSERT_EQUAL_INT(8, resp.total_time);
+    TEST_ASSERT_FALSE(srv_recv(fd, &resp));
+    close(fd);
+}
+
+void test_server_rejects_garbage(void) {
+    // Given
+    int fd = srv_connect(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+
+    // When: a frame whose length does not match its plen
+    unsigned char junk[32] = { 0 };
+    junk[0] = 5;
+    TEST_ASSERT_EQUAL_INT(sizeof(junk), write(fd, junk, sizeof(junk)));
+
+    // Then: the connection is dropped
+    struct srv_response resp;
+    TEST_ASSERT_FALSE(srv_recv(fd, &resp));
+    close(fd);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_server_pipelined);
+    RUN_TEST(test_server_split_frames_and_arena_growth);
+    RUN_TEST(test_server_half_close);
+    RUN_TEST(test_server_half_close_during_delivery);
+    RUN_TEST(test_server_rejects_garbage);
+    return UNITY_END();
+}
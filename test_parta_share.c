@@ -0,0 +1,113 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_share.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+
+void test_stride_equal_tickets_is_rr(void) {
+    // When: equal tickets and quantum 1 behave like RR(1)
+    procs = init_procs((int[]){3, 3}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = stride_run(procs, 2, NULL, 1, NULL);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(6, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(3, procs[1].wait);
+
+    // Freed in tearDown above
+}
+void test_stride_tickets(void) {
+    // When: tickets 3:1, quantum 1 -> P0 P1 P0 P0 P0 P1 P1 P1
+    double err[2];
+    procs = init_procs((int[]){4, 4}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = stride_run(procs, 2, (int[]){3, 1}, 1, err);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(8, total_time);
+    TEST_ASSERT_EQUAL_INT(1, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(4, procs[1].wait);
+    TEST_ASSERT_EQUAL_FLOAT(0.05, err[0]);
+    TEST_ASSERT_EQUAL_FLOAT(-0.03125, err[1]);
+
+    // Freed in tearDown above
+}
+void test_stride_somedone(void) {
+    // When: P1 has nothing to run
+    double err[3];
+    procs = init_procs((int[]){2, 0, 2}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = stride_run(procs, 3, (int[]){1, 5, 1}, 2, err);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(4, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(2, procs[2].wait);
+    TEST_ASSERT_EQUAL_FLOAT(0.0, err[1]);
+
+    // Freed in tearDown above
+}
+void test_lottery_single(void) {
+    // When
+    procs = init_procs((int[]){5}, 1);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = lottery_run(procs, 1, NULL, 2, 7, NULL);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(5, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+
+    // Freed in tearDown above
+}
+void test_lottery_share(void) {
+    // When: tickets 3:1 over long bursts
+    double err[2];
+    procs = init_procs((int[]){3000, 3000}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = lottery_run(procs, 2, (int[]){3, 1}, 1, 12345, err);
+
+    // Then: P0 finishes first, close to its 75% entitlement
+    TEST_ASSERT_EQUAL_INT(6000, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_TRUE(procs[0].wait < procs[1].wait);
+    TEST_ASSERT_TRUE(err[0] > -0.02 && err[0] < 0.02);
+    TEST_ASSERT_TRUE(err[1] > -0.02 && err[1] < 0.02);
+
+    // Freed in tearDown above
+}
+void test_share_invalid_tickets(void) {
+    procs = init_procs((int[]){5, 8}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT(0, lottery_run(procs, 2, (int[]){1, 0}, 2, 1, NULL));
+    TEST_ASSERT_EQUAL_INT(0, stride_run(procs, 2, (int[]){-1, 1}, 2, NULL));
+    TEST_ASSERT_EQUAL_INT(5, procs[0].burst_left);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_stride_equal_tickets_is_rr);
+    RUN_TEST(test_stride_tickets);
+    RUN_TEST(test_stride_somedone);
+    RUN_TEST(test_lottery_single);
+    RUN_TEST(test_lottery_share);
+    RUN_TEST(test_share_invalid_tickets);
+
+    return UNITY_END();
+}
@@ -0,0 +1,111 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_sketch.h"
+#include <stdlib.h> // For malloc/free
+
+static struct wait_sketch* a = NULL;
+static struct wait_sketch* b = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    a = malloc(sizeof(struct wait_sketch));
+    b = malloc(sizeof(struct wait_sketch));
+    sketch_init(a);
+    sketch_init(b);
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(a);
+    free(b);
+}
+
+void test_sketch_empty(void) {
+    TEST_ASSERT_EQUAL_INT(0, a->count);
+    TEST_ASSERT_EQUAL_INT(0, sketch_quantile(a, 0.99));
+}
+
+void test_sketch_small_values_exact(void) {
+    // Given: 1..100
+    for (int v = 1; v <= 100; v++) {
+        sketch_add(a, v);
+    }
+
+    // Then: nearest rank, as sched_summarize computes it
+    TEST_ASSERT_EQUAL_INT(1, sketch_quantile(a, 0.0));
+    TEST_ASSERT_EQUAL_INT(50, sketch_quantile(a, 0.50));
+    TEST_ASSERT_EQUAL_INT(99, sketch_quantile(a, 0.99));
+    TEST_ASSERT_EQUAL_INT(100, sketch_quantile(a, 1.0));
+    TEST_ASSERT_EQUAL_INT(1, a->min);
+    TEST_ASSERT_EQUAL_INT(100, a->max);
+}
+
+void test_sketch_relative_error(void) {
+    // Given: values spread over many powers of two
+    long long values[] = { 300, 1000, 4097, 123456, 9999999, 1LL << 40, (1LL << 62) + 12345 };
+    for (int i = 0; i < 7; i++) {
+        sketch_init(a);
+        sketch_add(a, 0);
+        sketch_add(a, values[i]);
+        sketch_add(a, values[i] + 1); // Max above the bucket of interest only sometimes
+
+        // When
+        long long q = sketch_quantile(a, 0.5);
+
+        // Then: never below, and within 2^-7
+        TEST_ASSERT_TRUE(q >= values[i]);
+        TEST_ASSERT_TRUE((double)(q - values[i]) <= values[i] / 128.0);
+    }
+}
+
+void test_sketch_merge(void) {
+    // Given: odd values in one sketch, even in the other
+    for (int v = 1; v <= 1000; v++) {
+        sketch_add((v % 2) ? a : b, v);
+    }
+
+    // When
+    sketch_merge(a, b);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(1000, a->count);
+    TEST_ASSERT_EQUAL_INT(1, a->min);
+    TEST_ASSERT_EQUAL_INT(1000, a->max);
+    long long p99 = sketch_quantile(a, 0.99);
+    TEST_ASSERT_TRUE(p99 >= 990 && p99 <= 990 + 990 / 128);
+}
+void test_welford_merge_matches_sequential(void) {
+    // Given: 1000 samples, all in one summary and split over three
+    struct welford all, parts[3];
+    welford_init(&all);
+    for (int p = 0; p < 3; p++) {
+        welford_init(&parts[p]);
+    }
+    for (int i = 0; i < 1000; i++) {
+        double x = (double)((i * 7919) % 101) + 1e6;
+        welford_add(&all, x);
+        welford_add(&parts[(i * i) % 3], x);
+    }
+
+    // When
+    welford_merge(&parts[0], &parts[1]);
+    welford_merge(&parts[0], &parts[2]);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(1000, parts[0].n);
+    TEST_ASSERT_TRUE(parts[0].mean - all.mean < 1e-6 && all.mean - parts[0].mean < 1e-6);
+    double var = welford_variance(&all);
+    double diff = welford_variance(&parts[0]) - var;
+    TEST_ASSERT_TRUE(diff < 1e-6 * var && -diff < 1e-6 * var);
+    TEST_ASSERT_TRUE(var > 800.0 && var < 900.0); // ~ (101^2 - 1) / 12
+    double ci = welford_ci95(&all);
+    TEST_ASSERT_TRUE(ci * ci > 0.999 * 3.8416 * var / 1000 && ci * ci < 1.001 * 3.8416 * var / 1000);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sketch_empty);
+    RUN_TEST(test_sketch_small_values_exact);
+    RUN_TEST(test_sketch_relative_error);
+    RUN_TEST(test_sketch_merge);
+    RUN_TEST(test_welford_merge_matches_sequential);
+    return UNITY_END();
+}
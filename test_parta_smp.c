@@ -0,0 +1,129 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_smp.h"
+#include <stdlib.h> // For malloc/free
+#include <string.h>
+
+void setUp(void) {
+    // Code to execute at test start up
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+}
+
+static unsigned int seed = 777;
+
+static int next_rand(int max) {
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 8) % (unsigned int)(max + 1));
+}
+
+void test_smp_steal_example(void) {
+    // Given: P0 and P2 start on CPU 0, P1 on CPU 1. CPU 1 is idle at 1
+    // and its request reaches CPU 0 at 2, which hands over P2 (arrives
+    // at 3, runs 3..5). Then every request is refused.
+    int bursts[] = { 6, 1, 2 };
+    struct smp_config config = { 2, 2, 1 };
+
+    for (int parallel = 0; parallel < 2; parallel++) {
+        struct pcb* procs = init_procs(bursts, 3);
+        struct smp_stats stats;
+
+        // When
+        bool ok = parallel ? smp_run_parallel(procs, 3, &config, 2, &stats)
+                           : smp_run(procs, 3, &config, &stats);
+
+        // Then
+        TEST_ASSERT_TRUE(ok);
+        TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+        TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+        TEST_ASSERT_EQUAL_INT(3, procs[2].wait);
+        TEST_ASSERT_EQUAL_INT(6, stats.total_time);
+        TEST_ASSERT_EQUAL_INT(1, stats.steals);
+        TEST_ASSERT_EQUAL_INT(6, stats.messages);
+        TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+        free(procs);
+    }
+}
+
+void test_smp_one_cpu_is_rr(void) {
+    // Given
+    int bursts[] = { 5, 0, 8, 2, 13, 1 };
+    struct pcb* expected = init_procs(bursts, 6);
+    struct pcb* actual = init_procs(bursts, 6);
+    struct smp_config config = { 1, 3, 4 };
+    struct smp_stats stats;
+
+    // When
+    int total = rr_run(expected, 6, 3);
+    bool ok = smp_run(actual, 6, &config, &stats);
+
+    // Then
+    TEST_ASSERT_TRUE(ok);
+    TEST_ASSERT_EQUAL_INT(total, stats.total_time);
+    TEST_ASSERT_EQUAL_MEMORY(expected, actual, sizeof(struct pcb) * 6);
+    TEST_ASSERT_EQUAL_INT(0, stats.messages);
+    free(expected);
+    free(actual);
+}
+
+void test_smp_parallel_matches_sequential(void) {
+    for (int t = 0; t < 60; t++) {
+        // Given
+        int plen = 1 + next_rand(60);
+        struct smp_config config = { 1 + next_rand(9), 1 + next_rand(4), 1 + next_rand(5) };
+        int* bursts = malloc(sizeof(int) * plen);
+        for (int i = 0; i < plen; i++) {
+            bursts[i] = next_rand(30);
+        }
+        struct pcb* expected = init_procs(bursts, plen);
+        struct pcb* actual = init_procs(bursts, plen);
+        struct smp_stats seq;
+        struct smp_stats par;
+
+        // When
+        bool ok = smp_run(expected, plen, &config, &seq);
+        ok = ok && smp_run_parallel(actual, plen, &config, 1 + t % 4, &par);
+
+        // Then
+        TEST_ASSERT_TRUE(ok);
+        TEST_ASSERT_EQUAL_MEMORY(expected, actual, sizeof(struct pcb) * plen);
+        TEST_ASSERT_EQUAL_INT(seq.total_time, par.total_time);
+        TEST_ASSERT_EQUAL_INT(seq.steals, par.steals);
+        TEST_ASSERT_EQUAL_INT(seq.messages, par.messages);
+        TEST_ASSERT_TRUE(config.cpus == 1 || par.epochs > 0);
+        free(bursts);
+        free(expected);
+        free(actual);
+    }
+}
+
+void test_smp_stealing_balances(void) {
+    // Given: all the work lands on CPU 0 of 4
+    int bursts[16] = { 0 };
+    for (int i = 0; i < 16; i += 4) {
+        bursts[i] = 40;
+    }
+    struct pcb* procs = init_procs(bursts, 16);
+    struct smp_config config = { 4, 5, 1 };
+    struct smp_stats stats;
+
+    // When
+    bool ok = smp_run(procs, 16, &config, &stats);
+
+    // Then: three of the four processes move, and finish far sooner than
+    // 160 ticks on one CPU
+    TEST_ASSERT_TRUE(ok);
+    TEST_ASSERT_EQUAL_INT(3, stats.steals);
+    TEST_ASSERT_TRUE(stats.total_time < 60);
+    TEST_ASSERT_FALSE(smp_run(procs, 16, &(struct smp_config){ 4, 5, 0 }, &stats));
+    free(procs);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_smp_steal_example);
+    RUN_TEST(test_smp_one_cpu_is_rr);
+    RUN_TEST(test_smp_parallel_matches_sequential);
+    RUN_TEST(test_smp_stealing_balances);
+    return UNITY_END();
+}
@@ -0,0 +1,118 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_stream.h"
+#include "parta.h"
+#include <stdlib.h> // For malloc/free
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+static struct fcfs_stream* stream = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    stream = malloc(sizeof(struct fcfs_stream));
+    fcfs_stream_init(stream);
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(stream);
+}
+
+/** Run fcfs_stream_fd over `text` fed through a temporary file. */
+static enum stream_status stream_text(const char* text, struct out_buf* out) {
+    FILE* f = tmpfile();
+    fputs(text, f);
+    fflush(f);
+    rewind(f);
+    enum stream_status status = fcfs_stream_fd(stream, fileno(f), out);
+    fclose(f);
+    return status;
+}
+
+void test_stream_push_matches_fcfs(void) {
+    // Given
+    int bursts[] = { 5, 0, 8, 2, 7, 3 };
+    struct pcb* procs = init_procs(bursts, 6);
+    int total = fcfs_run(procs, 6);
+
+    // When
+    double sum = 0.0;
+    for (int i = 0; i < 6; i++) {
+        TEST_ASSERT_EQUAL_INT(procs[i].wait, fcfs_stream_push(stream, bursts[i]));
+        sum += procs[i].wait;
+    }
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(6, stream->n);
+    TEST_ASSERT_EQUAL_INT(total, stream->clock);
+    TEST_ASSERT_TRUE(fcfs_stream_avg_wait(stream) == sum / 6);
+    TEST_ASSERT_EQUAL_INT(22, sketch_quantile(&stream->waits, 0.99));
+    free(procs);
+}
+
+void test_stream_fd_parses_and_writes(void) {
+    // Given
+    char path[] = "/tmp/parta_stream_XXXXXX";
+    int fd = mkstemp(path);
+    struct out_buf out;
+    out_init(&out, fd, 64);
+
+    // When: mixed separators, no trailing newline
+    enum stream_status status = stream_text("5 8,2\n\n 0\t4", &out);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(STREAM_OK, status);
+    TEST_ASSERT_EQUAL_INT(5, stream->n);
+    TEST_ASSERT_EQUAL_INT(19, stream->clock);
+    char written[64] = { 0 };
+    TEST_ASSERT_TRUE(pread(fd, written, sizeof(written) - 1, 0) > 0);
+    TEST_ASSERT_EQUAL_STRING("0 0\n1 5\n2 13\n3 0\n4 15\n", written);
+    out_free(&out);
+    close(fd);
+    unlink(path);
+}
+
+void test_stream_fd_spans_reads(void) {
+    // Given: more than one read buffer of input
+    int plen = 300000;
+    char* text = malloc((size_t)plen * 4 + 1);
+    char* p = text;
+    for (int i = 0; i < plen; i++) {
+        p += sprintf(p, "%d ", 10 + i % 90);
+    }
+
+    // When
+    enum stream_status status = stream_text(text, NULL);
+
+    // Then: numbers cut at a read boundary are still whole
+    long long total = 0;
+    for (int i = 0; i < plen; i++) {
+        total += 10 + i % 90;
+    }
+    TEST_ASSERT_EQUAL_INT(STREAM_OK, status);
+    TEST_ASSERT_EQUAL_INT(plen, stream->n);
+    TEST_ASSERT_TRUE(stream->clock == total);
+    free(text);
+}
+
+void test_stream_fd_rejects_bad_burst(void) {
+    const char* inputs[] = { "5 8 x2 3", "5 8 -2", "5 8 2147483648", "5 8 3a" };
+    for (int i = 0; i < 4; i++) {
+        // When
+        fcfs_stream_init(stream);
+        enum stream_status status = stream_text(inputs[i], NULL);
+
+        // Then: stopped at P2
+        TEST_ASSERT_EQUAL_INT(STREAM_EINPUT, status);
+        TEST_ASSERT_EQUAL_INT(2, stream->n);
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_stream_push_matches_fcfs);
+    RUN_TEST(test_stream_fd_parses_and_writes);
+    RUN_TEST(test_stream_fd_spans_reads);
+    RUN_TEST(test_stream_fd_rejects_bad_burst);
+    return UNITY_END();
+}
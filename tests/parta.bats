@@ -99,3 +99,330 @@ EOF
     assert [ "$status" -eq 0 ]                             # Assert if exit status matches
 }
 
+
+@test "parta_main prio 0" {
+    run parta_main prio 0
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Missing arguments
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main prio 0 5:2 8:0 2:1" {
+    run parta_main prio 0 5:2 8:0 2:1
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using PRIO(0).
+
+Accepted P0: Burst 5 Priority 2
+Accepted P1: Burst 8 Priority 0
+Accepted P2: Burst 2 Priority 1
+Average wait time: 6.00
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main prio-p 2 10:2 2:5" {
+    run parta_main prio-p 2 10:2 2:5
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using PRIO-P(2).
+
+Accepted P0: Burst 10 Priority 2
+Accepted P1: Burst 2 Priority 5
+Average wait time: 5.00
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main --quiet rr 2 5 8 2" {
+    run parta_main --quiet rr 2 5 8 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using RR(2).
+
+Average wait time: 5.67
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main fcfs 5 x 2" {
+    run parta_main fcfs 5 x 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid argument 'x'
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main rr 2x 5" {
+    run parta_main rr 2x 5
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid argument '2x'
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main prio 0 5:a" {
+    run parta_main prio 0 5:a
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid argument '5:a'
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main sjf 5 8 2" {
+    run parta_main sjf 5 8 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using SJF
+
+Accepted P0: Burst 5
+Accepted P1: Burst 8
+Accepted P2: Burst 2
+Average wait time: 3.00
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main compare fcfs rr:2 sjf 5 8 2" {
+    run parta_main compare fcfs rr:2 sjf 5 8 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+Comparing FCFS, RR(2), SJF
+
+Accepted P0: Burst 5
+Accepted P1: Burst 8
+Accepted P2: Burst 2
+
+Algorithm      Avg wait   P99 wait      Total
+FCFS               6.00         13         15
+RR(2)              5.67          7         15
+SJF                3.00          7         15
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main compare fcfs" {
+    run parta_main compare fcfs
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Missing arguments
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main compare rr 5" {
+    run parta_main compare rr 5
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid argument 'rr'
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main fcfs --stream" {
+    run bash -c "printf '5 8\n2' | parta_main fcfs --stream --out -"
+
+    cat << EOF | assert_output -   # Assert if output matches
+0 0
+1 5
+2 13
+Using FCFS
+
+Processes: 3
+Average wait time: 6.00
+P50 wait: 5
+P99 wait: 13
+Max wait: 13
+Total time: 15
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main fcfs --stream bad burst" {
+    run bash -c "printf '5 8 -2' | parta_main fcfs --stream"
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid burst for P2
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main rr-ooc 4" {
+    run bash -c "printf '5 8 2' | parta_main rr-ooc 4 --mem 1 --out -"
+
+    cat << EOF | assert_output -   # Assert if output matches
+0 6
+1 7
+2 8
+Using RR(4).
+
+Processes: 3
+Average wait time: 7.00
+P50 wait: 7
+P99 wait: 8
+Max wait: 8
+Total time: 15
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main rr-ooc 0" {
+    run parta_main rr-ooc 0
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid argument '0'
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main rr-opt mean 5 8 2" {
+    run parta_main rr-opt mean 5 8 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+Optimizing RR quantum for mean wait
+
+Accepted P0: Burst 5
+Accepted P1: Burst 8
+Accepted P2: Burst 2
+
+Best quantum: 5
+Average wait time: 5.67
+P99 wait: 10
+Total time: 15
+Quanta evaluated: 7 of 8
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main rr-opt switch:x 5" {
+    run parta_main rr-opt switch:x 5
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid argument 'switch:x'
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main mc fcfs uniform:5:5 3" {
+    run parta_main mc fcfs uniform:5:5 3 --ci 0.5
+
+    cat << EOF | assert_output -   # Assert if output matches
+Monte Carlo FCFS over 3 x uniform:5:5
+
+Workloads: 256 (converged)
+Average wait time: 5.00 +- 0.00
+P99 wait: 10.00 +- 0.00
+Total time: 15.00 +- 0.00
+Pooled P50 wait: 5
+Pooled P99 wait: 10
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main mc fcfs normal:1:2 3" {
+    run parta_main mc fcfs normal:1:2 3
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid argument 'normal:1:2'
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main smp 2 2 1 --threads 2 6 1 2" {
+    run parta_main smp 2 2 1 --threads 2 6 1 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using SMP RR(2) on 2 CPUs.
+
+Accepted P0: Burst 6
+Accepted P1: Burst 1
+Accepted P2: Burst 2
+Average wait time: 1.00
+Total time: 6
+Steals: 1
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main smp 2 2 0 6" {
+    run parta_main smp 2 2 0 6
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid argument '0'
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main group 1 a=3 30@a 30@b 30@a 30@b" {
+    run parta_main group 1 a=3 30@a 30@b 30@a 30@b
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using group shares (quantum 1).
+
+Accepted P0: Burst 30 Group /a
+Accepted P1: Burst 30 Group /b
+Accepted P2: Burst 30 Group /a
+Accepted P3: Burst 30 Group /b
+Average wait time: 69.50
+Total time: 120
+
+Group              Weight    Procs    Share   Avg wait
+/                       1        4  100.00%      69.50
+/a                      3        2   75.00%      49.50
+/b                      1        2   50.00%      89.50
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main group 1 a//b=2 5" {
+    run parta_main group 1 a//b=2 5
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid argument 'a//b=2'
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main eevdf 2 10:63 10 6:32" {
+    run parta_main eevdf 2 10:63 10 6:32
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using EEVDF(2).
+
+Accepted P0: Burst 10 Priority 63
+Accepted P1: Burst 10 Priority 0
+Accepted P2: Burst 6 Priority 32
+Average wait time: 11.33
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main hrrn 10 20 2:9 4:10" {
+    run parta_main hrrn 10 20 2:9 4:10
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using HRRN.
+
+Accepted P0: Burst 10 Arrival 0
+Accepted P1: Burst 20 Arrival 0
+Accepted P2: Burst 2 Arrival 9
+Accepted P3: Burst 4 Arrival 10
+Average wait time: 13.25
+Total time: 36
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main hrrn 3:-1" {
+    run parta_main hrrn 3:-1
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid argument '3:-1'
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}